@@ -11,6 +11,70 @@
 #define UNITY_PROGMEM
 #endif
 
+/* Block comparison of whole regions with memcmp before falling back to the
+ * per-element diagnostic walk. Only valid when test data lives in the default
+ * address space, so a custom pointer attribute disables it. */
+#if !defined(UNITY_EXCLUDE_BLOCK_COMPARE) && !defined(UNITY_POINTER_ATTRIBUTE)
+#include <string.h>
+#define UNITY_BLOCK_COMPARE_ENABLED
+#endif
+
+#ifdef UNITY_INCLUDE_FORK_ISOLATION
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <sys/wait.h>
+#endif
+
+/* Capture of code-under-test stdout/stderr into a temporary file around each
+ * test (POSIX fd redirection). Requires the buffered sink so Unity's own
+ * result stream can bypass the redirected descriptors. */
+#if defined(UNITY_INCLUDE_OUTPUT_CAPTURE) && !defined(UNITY_SKIP_DEFAULT_RUNNER)
+#include <stdio.h>
+#include <unistd.h>
+#define UNITY_OUTPUT_CAPTURE_ENABLED
+#endif
+
+/* Per-test watchdog. Needs alarm/SIGALRM and the setjmp abort frame to
+ * recover control from a hung test, so it is unavailable when setjmp has
+ * been excluded. */
+#if defined(UNITY_INCLUDE_TEST_TIMEOUT) && !defined(UNITY_EXCLUDE_SETJMP_H)
+#include <signal.h>
+#include <unistd.h>
+#define UNITY_TEST_TIMEOUT_ENABLED
+#ifndef UNITY_TEST_TIMEOUT_SECONDS
+#define UNITY_TEST_TIMEOUT_SECONDS 10
+#endif
+#endif
+
+/* Vectorized pass-path kernels for the float/double array tolerance
+ * assertions. Opt-in, and only when test data lives in the default address
+ * space; scalar code remains both the fallback and the diagnostic path. */
+#if defined(UNITY_INCLUDE_SIMD) && !defined(UNITY_POINTER_ATTRIBUTE) && !defined(UNITY_EXCLUDE_FLOAT)
+  #if defined(__SSE2__)
+    #include <emmintrin.h>
+    #define UNITY_SIMD_SSE2
+  #elif defined(__aarch64__) && defined(__ARM_NEON)
+    #include <arm_neon.h>
+    #define UNITY_SIMD_NEON
+  #endif
+#endif
+
+#ifdef UNITY_INCLUDE_PARALLEL
+#include <stdio.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#endif
+
+#ifdef UNITY_INCLUDE_BINARY_RESULTS
+#include <stdio.h>
+#endif
+
+#if defined(UNITY_INCLUDE_BINARY_RESULTS) || defined(UNITY_USE_COMMAND_LINE_ARGS)
+#include <string.h>
+#endif
+
 /* If omitted from header, declare overrideable prototypes here so they're ready for use */
 #ifdef UNITY_OMIT_OUTPUT_CHAR_HEADER_DECLARATION
 void UNITY_OUTPUT_CHAR(int);
@@ -21,7 +85,25 @@ void UNITY_OUTPUT_CHAR(int);
 #define UNITY_IGNORE_AND_BAIL       do { Unity.CurrentTestIgnored = 1; UNITY_OUTPUT_FLUSH(); TEST_ABORT(); } while (0)
 #define RETURN_IF_FAIL_OR_IGNORE    do { if (Unity.CurrentTestFailed || Unity.CurrentTestIgnored) { TEST_ABORT(); } } while (0)
 
+#ifdef UNITY_INCLUDE_CONTEXT
+/* The rest of this file reads and writes "Unity." as always; the macro in
+ * unity_internals.h redirects every access through the thread-local pointer
+ * so each worker thread sees only the context it bound. */
+static struct UNITY_STORAGE_T UnityDefaultContext;
+UNITY_THREAD_LOCAL struct UNITY_STORAGE_T* UnityContextPointer = &UnityDefaultContext;
+
+void UnitySetContext(struct UNITY_STORAGE_T* context)
+{
+    UnityContextPointer = (context != NULL) ? context : &UnityDefaultContext;
+}
+
+struct UNITY_STORAGE_T* UnityGetContext(void)
+{
+    return UnityContextPointer;
+}
+#else
 struct UNITY_STORAGE_T Unity;
+#endif
 
 #ifdef UNITY_OUTPUT_COLOR
 const char UNITY_PROGMEM UnityStrOk[]                            = "\033[42mOK\033[0m";
@@ -61,10 +143,26 @@ const char UNITY_PROGMEM UnityStrErrShorthand[]                  = "Unity Shorth
 const char UNITY_PROGMEM UnityStrErrFloat[]                      = "Unity Floating Point Disabled";
 const char UNITY_PROGMEM UnityStrErrDouble[]                     = "Unity Double Precision Disabled";
 const char UNITY_PROGMEM UnityStrErr64[]                         = "Unity 64-bit Support Disabled";
+#ifdef UNITY_INCLUDE_FORK_ISOLATION
+static const char UNITY_PROGMEM UnityStrCrashed[]                = " Test Crashed (Signal ";
+#endif
+#ifdef UNITY_TEST_TIMEOUT_ENABLED
+static const char UNITY_PROGMEM UnityStrTimeout[]                = " TIMEOUT (Exceeded ";
+static const char UNITY_PROGMEM UnityStrTimeoutSeconds[]         = " Seconds)";
+#endif
+#ifdef UNITY_OUTPUT_CAPTURE_ENABLED
+static const char UNITY_PROGMEM UnityStrCapturedOutput[]         = "Captured Output:";
+#endif
+#ifdef UNITY_INCLUDE_PARALLEL
+static const char UNITY_PROGMEM UnityStrCrashedWorker[]          = " Test Crashed In Worker.";
+#endif
 static const char UNITY_PROGMEM UnityStrBreaker[]                = "-----------------------";
 static const char UNITY_PROGMEM UnityStrResultsTests[]           = " Tests ";
 static const char UNITY_PROGMEM UnityStrResultsFailures[]        = " Failures ";
 static const char UNITY_PROGMEM UnityStrResultsIgnored[]         = " Ignored ";
+#ifdef UNITY_USE_COMMAND_LINE_ARGS
+static const char UNITY_PROGMEM UnityStrResultsSkipped[]         = " Skipped ";
+#endif
 #ifndef UNITY_EXCLUDE_DETAILS
 static const char UNITY_PROGMEM UnityStrDetail1Name[]            = UNITY_DETAIL1_NAME " ";
 static const char UNITY_PROGMEM UnityStrDetail2Name[]            = " " UNITY_DETAIL2_NAME " ";
@@ -73,6 +171,78 @@ static const char UNITY_PROGMEM UnityStrDetail2Name[]            = " " UNITY_DET
  * Pretty Printers & Test Result Output Handlers
  *-----------------------------------------------*/
 
+/*-----------------------------------------------*/
+/* Buffered output sink. Characters are collected here and handed to the
+ * registered write callback (or stdout) one whole buffer at a time. */
+#ifdef UNITY_OUTPUT_CAPTURE_ENABLED
+int UnityOutputCapture = 1;
+static FILE* UnityCaptureFile = NULL;
+static int UnityCaptureSavedStdout = -1;
+static int UnityCaptureSavedStderr = -1;
+static int UnityCaptureActive = 0;
+
+/* While the descriptors are redirected, Unity's own result stream must go to
+ * the saved stdout or it would be captured along with the code under test's
+ * output. The sink's flush routes here when a capture window is open. */
+static void UnityCaptureSinkWrite(const char* buffer, UNITY_UINT32 length)
+{
+    UNITY_UINT32 written = 0;
+    while (written < length)
+    {
+        ssize_t n = write(UnityCaptureSavedStdout, buffer + written, (size_t)(length - written));
+        if (n <= 0)
+        {
+            break;
+        }
+        written += (UNITY_UINT32)n;
+    }
+}
+#endif
+
+#ifdef UNITY_OUTPUT_BUFFERED
+static char UnityOutputBuffer[UNITY_OUTPUT_BUFFER_SIZE];
+static UNITY_UINT32 UnityOutputBufferLength = 0;
+static UNITY_OUTPUT_WRITE_T UnityOutputWriteFunction = NULL;
+
+void UnitySetOutputWriteFunction(UNITY_OUTPUT_WRITE_T writeFunction)
+{
+    UnityOutputWriteFunction = writeFunction;
+}
+
+void UnityOutputBufferFlush(void)
+{
+    if (UnityOutputBufferLength == 0)
+    {
+        return;
+    }
+    if (UnityOutputWriteFunction != NULL)
+    {
+        UnityOutputWriteFunction(UnityOutputBuffer, UnityOutputBufferLength);
+    }
+#ifdef UNITY_OUTPUT_CAPTURE_ENABLED
+    else if (UnityCaptureActive)
+    {
+        UnityCaptureSinkWrite(UnityOutputBuffer, UnityOutputBufferLength);
+    }
+#endif
+    else
+    {
+        (void)fwrite(UnityOutputBuffer, 1, (size_t)UnityOutputBufferLength, stdout);
+        (void)fflush(stdout);
+    }
+    UnityOutputBufferLength = 0;
+}
+
+void UnityOutputBufferChar(int ch)
+{
+    if (UnityOutputBufferLength >= (UNITY_UINT32)UNITY_OUTPUT_BUFFER_SIZE)
+    {
+        UnityOutputBufferFlush();
+    }
+    UnityOutputBuffer[UnityOutputBufferLength++] = (char)ch;
+}
+#endif /* UNITY_OUTPUT_BUFFERED */
+
 /*-----------------------------------------------*/
 /* Local helper function to print characters. */
 static void UnityPrintChar(const char* pch)
@@ -250,23 +420,45 @@ void UnityPrintNumber(const UNITY_INT number_to_print)
 }
 
 /*-----------------------------------------------
- * basically do an itoa using as little ram as possible */
+ * basically do an itoa, converting two digits per division via the
+ * pair table below and handing the finished buffer to the sink */
+static const char UNITY_PROGMEM UnityDigitPairs[] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
 void UnityPrintNumberUnsigned(const UNITY_UINT number)
 {
-    UNITY_UINT divisor = 1;
+    char buf[22]; /* 64-bit decimal worst case is 20 digits */
+    char* pch = &buf[sizeof(buf) - 1];
+    UNITY_UINT n = number;
 
-    /* figure out initial divisor */
-    while (number / divisor > 9)
+    *pch = 0;
+    while (n >= 100)
     {
-        divisor *= 10;
+        const char* pair = &UnityDigitPairs[(n % 100) * 2];
+        n /= 100;
+        *(--pch) = pair[1];
+        *(--pch) = pair[0];
     }
-
-    /* now mod and print, then divide divisor */
-    do
+    if (n >= 10)
+    {
+        const char* pair = &UnityDigitPairs[n * 2];
+        *(--pch) = pair[1];
+        *(--pch) = pair[0];
+    }
+    else
     {
-        UNITY_OUTPUT_CHAR((char)('0' + (number / divisor % 10)));
-        divisor /= 10;
-    } while (divisor > 0);
+        *(--pch) = (char)('0' + n);
+    }
+    UnityPrint(pch);
 }
 
 /*-----------------------------------------------*/
@@ -274,6 +466,8 @@ void UnityPrintNumberHex(const UNITY_UINT number, const char nibbles_to_print)
 {
     int nibble;
     char nibbles = nibbles_to_print;
+    char buf[UNITY_MAX_NIBBLES + 1];
+    int len = 0;
 
     if ((unsigned)nibbles > UNITY_MAX_NIBBLES)
     {
@@ -286,40 +480,38 @@ void UnityPrintNumberHex(const UNITY_UINT number, const char nibbles_to_print)
         nibble = (int)(number >> (nibbles * 4)) & 0x0F;
         if (nibble <= 9)
         {
-            UNITY_OUTPUT_CHAR((char)('0' + nibble));
+            buf[len++] = (char)('0' + nibble);
         }
         else
         {
-            UNITY_OUTPUT_CHAR((char)('A' - 10 + nibble));
+            buf[len++] = (char)('A' - 10 + nibble);
         }
     }
+    buf[len] = 0;
+    UnityPrint(buf);
 }
 
 /*-----------------------------------------------*/
 void UnityPrintMask(const UNITY_UINT mask, const UNITY_UINT number)
 {
     UNITY_UINT current_bit = (UNITY_UINT)1 << (UNITY_INT_WIDTH - 1);
+    char buf[UNITY_INT_WIDTH + 1];
     UNITY_INT32 i;
 
     for (i = 0; i < UNITY_INT_WIDTH; i++)
     {
         if (current_bit & mask)
         {
-            if (current_bit & number)
-            {
-                UNITY_OUTPUT_CHAR('1');
-            }
-            else
-            {
-                UNITY_OUTPUT_CHAR('0');
-            }
+            buf[i] = (current_bit & number) ? '1' : '0';
         }
         else
         {
-            UNITY_OUTPUT_CHAR('X');
+            buf[i] = 'X';
         }
         current_bit = current_bit >> 1;
     }
+    buf[UNITY_INT_WIDTH] = 0;
+    UnityPrint(buf);
 }
 
 /*-----------------------------------------------*/
@@ -373,6 +565,8 @@ void UnityPrintFloat(const UNITY_DOUBLE input_number)
         int         decimals;
         int         digits;
         char        buf[16] = {0};
+        char        line[24];
+        int         len = 0;
 
         /*
          * Scale up or down by powers of 10.  To minimize rounding error,
@@ -451,29 +645,30 @@ void UnityPrintFloat(const UNITY_DOUBLE input_number)
             n /= 10;
         }
 
-        /* print out buffer (backwards) */
+        /* assemble the whole number into one line buffer so it reaches the
+         * output sink in a single call instead of one call per character */
         while (digits > 0)
         {
             if (digits == decimals)
             {
-                UNITY_OUTPUT_CHAR('.');
+                line[len++] = '.';
             }
-            UNITY_OUTPUT_CHAR(buf[--digits]);
+            line[len++] = buf[--digits];
         }
 
-        /* print exponent if needed */
+        /* append exponent if needed */
         if (exponent != 0)
         {
-            UNITY_OUTPUT_CHAR('e');
+            line[len++] = 'e';
 
             if (exponent < 0)
             {
-                UNITY_OUTPUT_CHAR('-');
+                line[len++] = '-';
                 exponent = -exponent;
             }
             else
             {
-                UNITY_OUTPUT_CHAR('+');
+                line[len++] = '+';
             }
 
             digits = 0;
@@ -484,9 +679,12 @@ void UnityPrintFloat(const UNITY_DOUBLE input_number)
             }
             while (digits > 0)
             {
-                UNITY_OUTPUT_CHAR(buf[--digits]);
+                line[len++] = buf[--digits];
             }
         }
+
+        line[len] = 0;
+        UnityPrint(line);
     }
 }
 #endif /* ! UNITY_EXCLUDE_FLOAT_PRINT */
@@ -542,17 +740,259 @@ static void UnityTestResultsFailBegin(const UNITY_LINE_TYPE line)
     UNITY_OUTPUT_CHAR(':');
 }
 
+/*-----------------------------------------------*/
+#ifdef UNITY_INCLUDE_BINARY_RESULTS
+/* Compact length-prefixed result records, written to a side file selected
+ * with --binary-out=PATH. All integers are little-endian regardless of host.
+ *   header:      "UTB1"
+ *   file record: 'F' u16 len, bytes       (assigns the next file id, from 0)
+ *   test record: 'T' u16 file_id, u32 line, u8 status (0 pass / 1 fail /
+ *                2 ignore), u32 duration_ms, u16 len, name bytes
+ *   end record:  'E' u32 tests, u32 failures, u32 ignores
+ * Test names are emitted inline: with the default runner they are only known
+ * as each test runs, and generated names are unique so a name table would
+ * not deduplicate anything. File names repeat per test, so those get ids. */
+static FILE* UnityBinaryResultsFile = NULL;
+static const char* UnityBinaryResultsCurrentFile = NULL;
+static unsigned int UnityBinaryResultsFileId = 0;
+
+static void UnityBinaryPutU16(unsigned int value)
+{
+    (void)fputc((int)(value & 0xFF), UnityBinaryResultsFile);
+    (void)fputc((int)((value >> 8) & 0xFF), UnityBinaryResultsFile);
+}
+
+static void UnityBinaryPutU32(UNITY_UINT32 value)
+{
+    (void)fputc((int)(value & 0xFF), UnityBinaryResultsFile);
+    (void)fputc((int)((value >> 8) & 0xFF), UnityBinaryResultsFile);
+    (void)fputc((int)((value >> 16) & 0xFF), UnityBinaryResultsFile);
+    (void)fputc((int)((value >> 24) & 0xFF), UnityBinaryResultsFile);
+}
+
+static void UnityBinaryPutString(const char* string)
+{
+    size_t length = strlen(string);
+    if (length > 0xFFFF)
+    {
+        length = 0xFFFF;
+    }
+    UnityBinaryPutU16((unsigned int)length);
+    (void)fwrite(string, 1, length, UnityBinaryResultsFile);
+}
+
+int UnityBinaryResultsOpen(const char* path)
+{
+    UnityBinaryResultsFile = fopen(path, "wb");
+    if (UnityBinaryResultsFile == NULL)
+    {
+        return -1;
+    }
+    (void)fwrite("UTB1", 1, 4, UnityBinaryResultsFile);
+    UnityBinaryResultsCurrentFile = NULL;
+    UnityBinaryResultsFileId = 0;
+    return 0;
+}
+
+static void UnityBinaryResultsRecord(int status)
+{
+    if (UnityBinaryResultsFile == NULL)
+    {
+        return;
+    }
+
+    if (Unity.TestFile != UnityBinaryResultsCurrentFile)
+    {
+        (void)fputc('F', UnityBinaryResultsFile);
+        UnityBinaryPutString(Unity.TestFile);
+        UnityBinaryResultsCurrentFile = Unity.TestFile;
+        UnityBinaryResultsFileId++;
+    }
+
+    (void)fputc('T', UnityBinaryResultsFile);
+    UnityBinaryPutU16(UnityBinaryResultsFileId - 1);
+    UnityBinaryPutU32((UNITY_UINT32)Unity.CurrentTestLineNumber);
+    (void)fputc(status, UnityBinaryResultsFile);
+    UnityBinaryPutU32((UNITY_UINT32)UNITY_EXEC_TIME_ELAPSED_MS());
+    UnityBinaryPutString(Unity.CurrentTestName);
+}
+
+static void UnityBinaryResultsEnd(void)
+{
+    if (UnityBinaryResultsFile == NULL)
+    {
+        return;
+    }
+    (void)fputc('E', UnityBinaryResultsFile);
+    UnityBinaryPutU32((UNITY_UINT32)Unity.NumberOfTests);
+    UnityBinaryPutU32((UNITY_UINT32)Unity.TestFailures);
+    UnityBinaryPutU32((UNITY_UINT32)Unity.TestIgnores);
+    (void)fclose(UnityBinaryResultsFile);
+    UnityBinaryResultsFile = NULL;
+}
+#endif /* UNITY_INCLUDE_BINARY_RESULTS */
+
+/*-----------------------------------------------*/
+#ifdef UNITY_INCLUDE_SLOW_TEST_REPORT
+/* Small top-N table of the slowest tests, kept unsorted while the suite
+ * runs (one min-scan per test) and sorted once when UnityEnd reports it. */
+struct UNITY_SLOW_TEST_T
+{
+    const char* Name;
+    UNITY_UINT Milliseconds;
+};
+
+static struct UNITY_SLOW_TEST_T UnitySlowTests[UNITY_SLOW_TEST_REPORT_SIZE];
+static int UnitySlowTestCount = 0;
+
+static void UnitySlowTestRecord(void)
+{
+    UNITY_UINT elapsed = UNITY_EXEC_TIME_ELAPSED_MS();
+    int i;
+    int slowest_idx = 0;
+
+    if (UnitySlowTestCount < UNITY_SLOW_TEST_REPORT_SIZE)
+    {
+        UnitySlowTests[UnitySlowTestCount].Name = Unity.CurrentTestName;
+        UnitySlowTests[UnitySlowTestCount].Milliseconds = elapsed;
+        UnitySlowTestCount++;
+        return;
+    }
+
+    /* replace the table minimum if this test is slower */
+    for (i = 1; i < UNITY_SLOW_TEST_REPORT_SIZE; i++)
+    {
+        if (UnitySlowTests[i].Milliseconds < UnitySlowTests[slowest_idx].Milliseconds)
+        {
+            slowest_idx = i;
+        }
+    }
+    if (elapsed > UnitySlowTests[slowest_idx].Milliseconds)
+    {
+        UnitySlowTests[slowest_idx].Name = Unity.CurrentTestName;
+        UnitySlowTests[slowest_idx].Milliseconds = elapsed;
+    }
+}
+
+static void UnitySlowTestReport(void)
+{
+    int i;
+    int j;
+
+    if (UnitySlowTestCount == 0)
+    {
+        return;
+    }
+
+    /* insertion sort, slowest first; the table is at most a few entries */
+    for (i = 1; i < UnitySlowTestCount; i++)
+    {
+        struct UNITY_SLOW_TEST_T entry = UnitySlowTests[i];
+        for (j = i; (j > 0) && (UnitySlowTests[j - 1].Milliseconds < entry.Milliseconds); j--)
+        {
+            UnitySlowTests[j] = UnitySlowTests[j - 1];
+        }
+        UnitySlowTests[j] = entry;
+    }
+
+    UNITY_PRINT_EOL();
+    UnityPrint("Slowest Tests:");
+    UNITY_PRINT_EOL();
+    for (i = 0; i < UnitySlowTestCount; i++)
+    {
+        UnityPrint(UnitySlowTests[i].Name);
+        UnityPrint(" (");
+        UnityPrintNumberUnsigned(UnitySlowTests[i].Milliseconds);
+        UnityPrint(" ms)");
+        UNITY_PRINT_EOL();
+    }
+}
+#endif /* UNITY_INCLUDE_SLOW_TEST_REPORT */
+
+/*-----------------------------------------------*/
+/* Expectation set: per-element verification loops accumulate records into
+ * these preallocated arrays and verify them at one assert point instead of
+ * paying a full assertion per element. Parallel arrays keep the compare loop
+ * over expected/actual a straight two-pointer walk the compiler vectorizes. */
+#ifdef UNITY_INCLUDE_EXPECT_SET
+static UNITY_INT UnityExpectExpected[UNITY_EXPECT_SET_SIZE];
+static UNITY_INT UnityExpectActual[UNITY_EXPECT_SET_SIZE];
+static UNITY_LINE_TYPE UnityExpectLine[UNITY_EXPECT_SET_SIZE];
+static UNITY_UINT32 UnityExpectCount = 0;
+static UNITY_UINT32 UnityExpectBase = 0; /* records verified by overflow flushes */
+
+void UnityVerifyExpectations(const UNITY_LINE_TYPE lineNumber)
+{
+    UNITY_UINT32 i;
+
+    RETURN_IF_FAIL_OR_IGNORE;
+    (void)lineNumber;
+
+    for (i = 0; i < UnityExpectCount; i++)
+    {
+        if (UnityExpectExpected[i] != UnityExpectActual[i])
+        {
+            /* report against the line that recorded the expectation */
+            UnityTestResultsFailBegin(UnityExpectLine[i]);
+            UnityPrint(UnityStrElement);
+            UnityPrintNumberUnsigned(UnityExpectBase + i);
+            UnityPrint(UnityStrExpected);
+            UnityPrintNumberByStyle(UnityExpectExpected[i], UNITY_DISPLAY_STYLE_INT);
+            UnityPrint(UnityStrWas);
+            UnityPrintNumberByStyle(UnityExpectActual[i], UNITY_DISPLAY_STYLE_INT);
+            UnityExpectCount = 0;
+            UnityExpectBase = 0;
+            UNITY_FAIL_AND_BAIL;
+        }
+    }
+    UnityExpectCount = 0;
+    UnityExpectBase = 0;
+}
+
+void UnityExpectEqualNumber(const UNITY_INT expected, const UNITY_INT actual, const UNITY_LINE_TYPE lineNumber)
+{
+    if (UnityExpectCount == (UNITY_UINT32)UNITY_EXPECT_SET_SIZE)
+    {
+        /* Arena full: verify what we have so far. Indices of later records
+         * stay meaningful through the base offset. */
+        const UNITY_UINT32 base = UnityExpectBase + UnityExpectCount;
+        UnityVerifyExpectations(lineNumber);
+        UnityExpectBase = base;
+    }
+    UnityExpectExpected[UnityExpectCount] = expected;
+    UnityExpectActual[UnityExpectCount] = actual;
+    UnityExpectLine[UnityExpectCount] = lineNumber;
+    UnityExpectCount++;
+}
+#endif /* UNITY_INCLUDE_EXPECT_SET */
+
 /*-----------------------------------------------*/
 void UnityConcludeTest(void)
 {
+    int print_line = 1;
+
+#ifdef UNITY_INCLUDE_BINARY_RESULTS
+    UnityBinaryResultsRecord(Unity.CurrentTestIgnored ? 2 : (Unity.CurrentTestFailed ? 1 : 0));
+#endif
+
     if (Unity.CurrentTestIgnored)
     {
         Unity.TestIgnores++;
     }
     else if (!Unity.CurrentTestFailed)
     {
-        UnityTestResultsBegin(Unity.TestFile, Unity.CurrentTestLineNumber);
-        UnityPrint(UnityStrPass);
+#ifdef UNITY_INCLUDE_BINARY_RESULTS
+        /* pass lines are carried by the binary stream while it is active */
+        if (UnityBinaryResultsFile != NULL)
+        {
+            print_line = 0;
+        }
+        else
+#endif
+        {
+            UnityTestResultsBegin(Unity.TestFile, Unity.CurrentTestLineNumber);
+            UnityPrint(UnityStrPass);
+        }
     }
     else
     {
@@ -561,9 +1001,20 @@ void UnityConcludeTest(void)
 
     Unity.CurrentTestFailed = 0;
     Unity.CurrentTestIgnored = 0;
-    UNITY_PRINT_EXEC_TIME();
-    UNITY_PRINT_EOL();
-    UNITY_FLUSH_CALL();
+#ifdef UNITY_INCLUDE_EXPECT_SET
+    /* drop any records an aborted test left unverified */
+    UnityExpectCount = 0;
+    UnityExpectBase = 0;
+#endif
+#ifdef UNITY_INCLUDE_SLOW_TEST_REPORT
+    UnitySlowTestRecord();
+#endif
+    if (print_line)
+    {
+        UNITY_PRINT_EXEC_TIME();
+        UNITY_PRINT_EOL();
+        UNITY_FLUSH_CALL();
+    }
 }
 
 /*-----------------------------------------------*/
@@ -811,6 +1262,26 @@ void UnityAssertEqualIntArray(UNITY_INTERNAL_PTR expected,
         UNITY_FAIL_AND_BAIL;
     }
 
+#ifdef UNITY_BLOCK_COMPARE_ENABLED
+    /* Identical regions always pass, so compare the whole block first and
+     * only decode element-by-element when we must report a mismatch. */
+    if (flags == UNITY_ARRAY_TO_ARRAY)
+    {
+        unsigned int bytes_per_element = length;
+#ifndef UNITY_SUPPORT_64
+        if (bytes_per_element == 8) { bytes_per_element = 4; }
+#endif
+        if ((bytes_per_element != 1) && (bytes_per_element != 2) && (bytes_per_element != 8))
+        {
+            bytes_per_element = 4;
+        }
+        if (memcmp(expected, actual, (size_t)num_elements * bytes_per_element) == 0)
+        {
+            return;
+        }
+    }
+#endif
+
     while ((elements > 0) && (elements--))
     {
         UNITY_INT expect_val;
@@ -929,6 +1400,70 @@ static int UnityFloatsWithin(UNITY_FLOAT delta, UNITY_FLOAT expected, UNITY_FLOA
     UNITY_FLOAT_OR_DOUBLE_WITHIN(delta, expected, actual, diff);
 }
 
+/*-----------------------------------------------*/
+#if defined(UNITY_SIMD_SSE2) || defined(UNITY_SIMD_NEON)
+/* Verify |expected - actual| <= delta + |expected| * UNITY_FLOAT_PRECISION
+ * four lanes at a time. Returns the index of the first four-element block
+ * containing a lane that failed the plain comparison (NaN lanes compare
+ * false and land here too), so the scalar walk can re-examine it with the
+ * inf/NaN equality rules and report the exact element. Returns the number
+ * of verified elements when no lane failed; the tail stays scalar. */
+static UNITY_UINT32 UnityFloatArrayBlockWithin(UNITY_FLOAT delta,
+                                               const UNITY_FLOAT* expected,
+                                               const UNITY_FLOAT* actual,
+                                               UNITY_UINT32 num_elements)
+{
+    UNITY_UINT32 i = 0;
+
+    if (sizeof(UNITY_FLOAT) != sizeof(float))
+    {
+        return 0; /* kernels assume single precision storage */
+    }
+
+#ifdef UNITY_SIMD_SSE2
+    {
+        const __m128 vdelta   = _mm_set1_ps((float)delta);
+        const __m128 vprec    = _mm_set1_ps((float)UNITY_FLOAT_PRECISION);
+        const __m128 vabsmask = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+
+        while ((i + 4) <= num_elements)
+        {
+            __m128 ve   = _mm_loadu_ps((const float*)&expected[i]);
+            __m128 va   = _mm_loadu_ps((const float*)&actual[i]);
+            __m128 vtol = _mm_add_ps(vdelta, _mm_and_ps(_mm_mul_ps(ve, vprec), vabsmask));
+            __m128 vdif = _mm_and_ps(_mm_sub_ps(va, ve), vabsmask);
+            if (_mm_movemask_ps(_mm_cmple_ps(vdif, vtol)) != 0xF)
+            {
+                return i;
+            }
+            i += 4;
+        }
+    }
+#endif
+#ifdef UNITY_SIMD_NEON
+    {
+        const float32x4_t vdelta = vdupq_n_f32((float)delta);
+        const float32x4_t vprec  = vdupq_n_f32((float)UNITY_FLOAT_PRECISION);
+
+        while ((i + 4) <= num_elements)
+        {
+            float32x4_t ve   = vld1q_f32((const float*)&expected[i]);
+            float32x4_t va   = vld1q_f32((const float*)&actual[i]);
+            float32x4_t vtol = vaddq_f32(vdelta, vabsq_f32(vmulq_f32(ve, vprec)));
+            float32x4_t vdif = vabsq_f32(vsubq_f32(va, ve));
+            if (vminvq_u32(vcleq_f32(vdif, vtol)) == 0)
+            {
+                return i;
+            }
+            i += 4;
+        }
+    }
+#endif
+
+    return i;
+}
+#endif /* UNITY_SIMD_SSE2 || UNITY_SIMD_NEON */
+
 /*-----------------------------------------------*/
 void UnityAssertWithinFloatArray(const UNITY_FLOAT delta,
                                  UNITY_PTR_ATTRIBUTE const UNITY_FLOAT* expected,
@@ -982,6 +1517,22 @@ void UnityAssertWithinFloatArray(const UNITY_FLOAT delta,
         in_delta = -in_delta;
     }
 
+#if defined(UNITY_SIMD_SSE2) || defined(UNITY_SIMD_NEON)
+    if (flags == UNITY_ARRAY_TO_ARRAY)
+    {
+        UNITY_UINT32 verified = UnityFloatArrayBlockWithin(in_delta, ptr_expected, ptr_actual, elements);
+        ptr_expected += verified;
+        ptr_actual += verified;
+        elements -= verified;
+        if (elements == 0)
+        {
+            return;
+        }
+        /* the scalar walk below re-checks the block that tripped the kernel
+         * (and any tail), applying the inf/NaN rules and reporting */
+    }
+#endif
+
     while (elements--)
     {
         current_element_delta = *ptr_expected * UNITY_FLOAT_PRECISION;
@@ -1157,6 +1708,69 @@ static int UnityDoublesWithin(UNITY_DOUBLE delta, UNITY_DOUBLE expected, UNITY_D
     UNITY_FLOAT_OR_DOUBLE_WITHIN(delta, expected, actual, diff);
 }
 
+/*-----------------------------------------------*/
+#if defined(UNITY_SIMD_SSE2) || defined(UNITY_SIMD_NEON)
+/* Double-precision twin of UnityFloatArrayBlockWithin, two lanes at a time.
+ * Same contract: returns the count of verified elements, stopping at the
+ * first block with a lane that failed the plain tolerance compare. */
+static UNITY_UINT32 UnityDoubleArrayBlockWithin(UNITY_DOUBLE delta,
+                                                const UNITY_DOUBLE* expected,
+                                                const UNITY_DOUBLE* actual,
+                                                UNITY_UINT32 num_elements)
+{
+    UNITY_UINT32 i = 0;
+
+    if (sizeof(UNITY_DOUBLE) != sizeof(double))
+    {
+        return 0; /* kernels assume double precision storage */
+    }
+
+#ifdef UNITY_SIMD_SSE2
+    {
+        const __m128d vdelta   = _mm_set1_pd((double)delta);
+        const __m128d vprec    = _mm_set1_pd((double)UNITY_DOUBLE_PRECISION);
+        const __m128d vabsmask = _mm_castsi128_pd(_mm_set_epi32(0x7FFFFFFF, (int)0xFFFFFFFF, 0x7FFFFFFF, (int)0xFFFFFFFF));
+
+        while ((i + 2) <= num_elements)
+        {
+            __m128d ve   = _mm_loadu_pd((const double*)&expected[i]);
+            __m128d va   = _mm_loadu_pd((const double*)&actual[i]);
+            __m128d vtol = _mm_add_pd(vdelta, _mm_and_pd(_mm_mul_pd(ve, vprec), vabsmask));
+            __m128d vdif = _mm_and_pd(_mm_sub_pd(va, ve), vabsmask);
+            if (_mm_movemask_pd(_mm_cmple_pd(vdif, vtol)) != 0x3)
+            {
+                return i;
+            }
+            i += 2;
+        }
+    }
+#endif
+#ifdef UNITY_SIMD_NEON
+    {
+        const float64x2_t vdelta = vdupq_n_f64((double)delta);
+        const float64x2_t vprec  = vdupq_n_f64((double)UNITY_DOUBLE_PRECISION);
+
+        while ((i + 2) <= num_elements)
+        {
+            float64x2_t ve   = vld1q_f64((const double*)&expected[i]);
+            float64x2_t va   = vld1q_f64((const double*)&actual[i]);
+            float64x2_t vtol = vaddq_f64(vdelta, vabsq_f64(vmulq_f64(ve, vprec)));
+            float64x2_t vdif = vabsq_f64(vsubq_f64(va, ve));
+            /* No 64-bit UMINV exists; the compare lanes are all-ones or
+             * all-zeros, so reducing the 32-bit halves is equivalent. */
+            if (vminvq_u32(vreinterpretq_u32_u64(vcleq_f64(vdif, vtol))) == 0)
+            {
+                return i;
+            }
+            i += 2;
+        }
+    }
+#endif
+
+    return i;
+}
+#endif /* UNITY_SIMD_SSE2 || UNITY_SIMD_NEON */
+
 /*-----------------------------------------------*/
 void UnityAssertWithinDoubleArray(const UNITY_DOUBLE delta,
                                   UNITY_PTR_ATTRIBUTE const UNITY_DOUBLE* expected,
@@ -1210,6 +1824,20 @@ void UnityAssertWithinDoubleArray(const UNITY_DOUBLE delta,
         in_delta = -in_delta;
     }
 
+#if defined(UNITY_SIMD_SSE2) || defined(UNITY_SIMD_NEON)
+    if (flags == UNITY_ARRAY_TO_ARRAY)
+    {
+        UNITY_UINT32 verified = UnityDoubleArrayBlockWithin(in_delta, ptr_expected, ptr_actual, elements);
+        ptr_expected += verified;
+        ptr_actual += verified;
+        elements -= verified;
+        if (elements == 0)
+        {
+            return;
+        }
+    }
+#endif
+
     while (elements--)
     {
         current_element_delta = *ptr_expected * UNITY_DOUBLE_PRECISION;
@@ -1458,11 +2086,31 @@ void UnityAssertNumbersArrayWithin(const UNITY_UINT delta,
         UNITY_FAIL_AND_BAIL;
     }
 
-    while ((elements > 0) && (elements--))
+#ifdef UNITY_BLOCK_COMPARE_ENABLED
+    /* With a delta of zero this degenerates to an equality check, so the
+     * block compare shortcut from UnityAssertEqualIntArray applies here too. */
+    if ((delta == 0) && (flags == UNITY_ARRAY_TO_ARRAY))
     {
-        UNITY_INT expect_val;
-        UNITY_INT actual_val;
-
+        unsigned int bytes_per_element = length;
+#ifndef UNITY_SUPPORT_64
+        if (bytes_per_element == 8) { bytes_per_element = 4; }
+#endif
+        if ((bytes_per_element != 1) && (bytes_per_element != 2) && (bytes_per_element != 8))
+        {
+            bytes_per_element = 4;
+        }
+        if (memcmp(expected, actual, (size_t)num_elements * bytes_per_element) == 0)
+        {
+            return;
+        }
+    }
+#endif
+
+    while ((elements > 0) && (elements--))
+    {
+        UNITY_INT expect_val;
+        UNITY_INT actual_val;
+
         switch (length)
         {
             case 1:
@@ -1600,6 +2248,14 @@ void UnityAssertEqualString(const char* expected,
     /* if both pointers not null compare the strings */
     if (expected && actual)
     {
+#ifdef UNITY_BLOCK_COMPARE_ENABLED
+        /* Let libc's vectorized strcmp settle the common passing case; the
+         * byte walk below only runs once the strings are known to differ. */
+        if (strcmp(expected, actual) == 0)
+        {
+            return;
+        }
+#endif
         for (i = 0; expected[i] || actual[i]; i++)
         {
             if (expected[i] != actual[i])
@@ -1640,6 +2296,14 @@ void UnityAssertEqualStringLen(const char* expected,
     /* if both pointers not null compare the strings */
     if (expected && actual)
     {
+#ifdef UNITY_BLOCK_COMPARE_ENABLED
+        /* strncmp stops at the first difference, a NUL in both, or length --
+         * exactly the walk below -- so a zero result is a clean pass. */
+        if (strncmp(expected, actual, length) == 0)
+        {
+            return;
+        }
+#endif
         for (i = 0; (i < length) && (expected[i] || actual[i]); i++)
         {
             if (expected[i] != actual[i])
@@ -1717,12 +2381,17 @@ void UnityAssertEqualStringArray(UNITY_INTERNAL_PTR expected,
         /* if both pointers not null compare the strings */
         if (expd && act)
         {
-            for (i = 0; expd[i] || act[i]; i++)
+#ifdef UNITY_BLOCK_COMPARE_ENABLED
+            if (strcmp(expd, act) != 0) /* byte walk only re-runs on mismatch */
+#endif
             {
-                if (expd[i] != act[i])
+                for (i = 0; expd[i] || act[i]; i++)
                 {
-                    Unity.CurrentTestFailed = 1;
-                    break;
+                    if (expd[i] != act[i])
+                    {
+                        Unity.CurrentTestFailed = 1;
+                        break;
+                    }
                 }
             }
         }
@@ -1788,6 +2457,16 @@ void UnityAssertEqualMemory(UNITY_INTERNAL_PTR expected,
         UNITY_FAIL_AND_BAIL;
     }
 
+#ifdef UNITY_BLOCK_COMPARE_ENABLED
+    if (flags == UNITY_ARRAY_TO_ARRAY)
+    {
+        if (memcmp(expected, actual, (size_t)num_elements * length) == 0)
+        {
+            return;
+        }
+    }
+#endif
+
     while (elements--)
     {
         bytes = length;
@@ -2190,25 +2869,465 @@ void UnityMessage(const char* msg, const UNITY_LINE_TYPE line)
 /*-----------------------------------------------*/
 /* If we have not defined our own test runner, then include our default test runner to make life easier */
 #ifndef UNITY_SKIP_DEFAULT_RUNNER
-void UnityDefaultTestRun(UnityTestFunction Func, const char* FuncName, const int FuncLineNum)
+
+#ifdef UNITY_TEST_TIMEOUT_ENABLED
+int UnityTestTimeoutSeconds = UNITY_TEST_TIMEOUT_SECONDS;
+static volatile sig_atomic_t UnityTestTimedOut = 0;
+
+/* SIGALRM lands here while the hung test (or its tearDown) is still on the
+ * stack; jumping to the abort frame is the same recovery path a failing
+ * assertion takes, so the runner regains control and moves on. */
+static void UnityTimeoutHandler(int sig)
+{
+    (void)sig;
+    UnityTestTimedOut = 1;
+    longjmp(Unity.AbortFrame, 1);
+}
+
+static void UnityTimeoutArm(void)
+{
+    static int handler_installed = 0;
+    if (UnityTestTimeoutSeconds <= 0)
+    {
+        return; /* pass path cost when disabled: one compare */
+    }
+    if (!handler_installed)
+    {
+        /* longjmp out of the handler does not restore the signal mask, so
+         * SIGALRM must not be blocked on delivery (SA_NODEFER) or the
+         * watchdog would fire exactly once and every later hang would hang
+         * the whole run. */
+        struct sigaction sa;
+        sa.sa_handler = UnityTimeoutHandler;
+        (void)sigemptyset(&sa.sa_mask);
+        sa.sa_flags = SA_NODEFER;
+        (void)sigaction(SIGALRM, &sa, NULL);
+        handler_installed = 1;
+    }
+    UnityTestTimedOut = 0;
+    (void)alarm((unsigned int)UnityTestTimeoutSeconds);
+}
+
+static void UnityTimeoutDisarmAndReport(void)
+{
+    if (UnityTestTimeoutSeconds <= 0)
+    {
+        return;
+    }
+    (void)alarm(0);
+    if (UnityTestTimedOut)
+    {
+        UnityTestTimedOut = 0;
+        UnityTestResultsFailBegin(Unity.CurrentTestLineNumber);
+        UnityPrint(UnityStrTimeout);
+        UnityPrintNumberUnsigned((UNITY_UINT)UnityTestTimeoutSeconds);
+        UnityPrint(UnityStrTimeoutSeconds);
+        UNITY_PRINT_EOL();
+        Unity.CurrentTestFailed = 1;
+    }
+}
+#endif
+
+#ifdef UNITY_OUTPUT_CAPTURE_ENABLED
+/* Open a capture window: everything the code under test writes to fds 1 and 2
+ * lands in a reusable temporary file instead of the console. On any error the
+ * window simply does not open and the test runs uncaptured. */
+static void UnityCaptureBegin(void)
+{
+    if (!UnityOutputCapture)
+    {
+        return;
+    }
+    if (UnityCaptureFile == NULL)
+    {
+        UnityCaptureFile = tmpfile();
+        if (UnityCaptureFile == NULL)
+        {
+            UnityOutputCapture = 0;
+            return;
+        }
+    }
+    UNITY_OUTPUT_FLUSH();
+    (void)fflush(stdout);
+    (void)fflush(stderr);
+    UnityCaptureSavedStdout = dup(1);
+    UnityCaptureSavedStderr = dup(2);
+    if ((UnityCaptureSavedStdout < 0) || (UnityCaptureSavedStderr < 0))
+    {
+        if (UnityCaptureSavedStdout >= 0) { (void)close(UnityCaptureSavedStdout); }
+        if (UnityCaptureSavedStderr >= 0) { (void)close(UnityCaptureSavedStderr); }
+        return;
+    }
+    rewind(UnityCaptureFile);
+    (void)dup2(fileno(UnityCaptureFile), 1);
+    (void)dup2(fileno(UnityCaptureFile), 2);
+    UnityCaptureActive = 1;
+}
+
+/* Close the window: restore the descriptors, then replay the captured bytes
+ * into the diagnostics when the test failed and throw them away otherwise. */
+static void UnityCaptureEnd(void)
+{
+    long captured;
+
+    if (!UnityCaptureActive)
+    {
+        return;
+    }
+    (void)fflush(stdout);
+    (void)fflush(stderr);
+    /* The code under test wrote through the duplicated descriptor, not the
+     * FILE stream, so the write position lives in the fd. */
+    captured = (long)lseek(fileno(UnityCaptureFile), 0, SEEK_CUR);
+    (void)dup2(UnityCaptureSavedStdout, 1);
+    (void)dup2(UnityCaptureSavedStderr, 2);
+    (void)close(UnityCaptureSavedStdout);
+    (void)close(UnityCaptureSavedStderr);
+    UnityCaptureActive = 0;
+
+    if (Unity.CurrentTestFailed && (captured > 0))
+    {
+        int ch = 0;
+        (void)fseek(UnityCaptureFile, 0L, SEEK_SET);
+        UNITY_PRINT_EOL(); /* terminate the pending FAIL line */
+        UnityPrint(UnityStrCapturedOutput);
+        UNITY_PRINT_EOL();
+        while (captured-- > 0)
+        {
+            ch = fgetc(UnityCaptureFile);
+            if (ch == EOF)
+            {
+                break;
+            }
+            if (ch == '\n')
+            {
+                UNITY_PRINT_EOL();
+            }
+            else
+            {
+                UNITY_OUTPUT_CHAR(ch);
+            }
+        }
+        if (ch != '\n')
+        {
+            UNITY_PRINT_EOL();
+        }
+        UNITY_OUTPUT_FLUSH();
+    }
+}
+#endif
+
+static void UnityRunSingleTest(UnityTestFunction Func)
 {
-    Unity.CurrentTestName = FuncName;
-    Unity.CurrentTestLineNumber = (UNITY_LINE_TYPE)FuncLineNum;
-    Unity.NumberOfTests++;
     UNITY_CLR_DETAILS();
     UNITY_EXEC_TIME_START();
+#ifdef UNITY_OUTPUT_CAPTURE_ENABLED
+    UnityCaptureBegin();
+#endif
+#ifdef UNITY_TEST_TIMEOUT_ENABLED
+    UnityTimeoutArm();
+#endif
     if (TEST_PROTECT())
     {
         setUp();
-        Func();
+#ifdef UNITY_USE_ABORT_FLAG
+        /* Without longjmp a setUp failure only returns from setUp itself,
+         * so the flags must be re-checked before entering the test body. */
+        if (!Unity.CurrentTestFailed && !Unity.CurrentTestIgnored)
+#endif
+        {
+            Func();
+        }
     }
     if (TEST_PROTECT())
     {
         tearDown();
     }
+#ifdef UNITY_TEST_TIMEOUT_ENABLED
+    UnityTimeoutDisarmAndReport();
+#endif
+#ifdef UNITY_OUTPUT_CAPTURE_ENABLED
+    UnityCaptureEnd();
+#endif
     UNITY_EXEC_TIME_STOP();
     UnityConcludeTest();
 }
+
+#ifdef UNITY_INCLUDE_FORK_ISOLATION
+int UnityForkIsolation = 1;
+
+/* Run one test in a forked child and fold its outcome into the parent's
+ * counters. The child prints its own result line; the parent only reports
+ * when the child died of a signal, which would otherwise take the whole
+ * harness (and every remaining test) down with it. */
+static int UnityForkAndRunTest(UnityTestFunction Func)
+{
+    pid_t child;
+    int status = 0;
+
+    /* Drain both Unity's sink and stdio before forking, otherwise pending
+     * output is duplicated into every child and replayed when it exits. */
+    UNITY_OUTPUT_FLUSH();
+    (void)fflush(NULL);
+    child = fork();
+    if (child < 0)
+    {
+        return 0; /* fork failed, caller runs the test in-process */
+    }
+
+    if (child == 0)
+    {
+        UNITY_COUNTER_TYPE failures_before = Unity.TestFailures;
+        UNITY_COUNTER_TYPE ignores_before  = Unity.TestIgnores;
+        UnityRunSingleTest(Func);
+        if (Unity.TestFailures != failures_before) { exit(1); }
+        if (Unity.TestIgnores  != ignores_before)  { exit(2); }
+        exit(0);
+    }
+
+    (void)waitpid(child, &status, 0);
+    if (WIFEXITED(status))
+    {
+        if (WEXITSTATUS(status) == 1) { Unity.TestFailures++; }
+        if (WEXITSTATUS(status) == 2) { Unity.TestIgnores++;  }
+    }
+    else if (WIFSIGNALED(status))
+    {
+        UnityTestResultsBegin(Unity.TestFile, Unity.CurrentTestLineNumber);
+        UnityPrint(UnityStrFail);
+        UNITY_OUTPUT_CHAR(':');
+        UnityPrint(UnityStrCrashed);
+        UnityPrintNumber((UNITY_INT)WTERMSIG(status));
+        UNITY_OUTPUT_CHAR(')');
+        UNITY_PRINT_EOL();
+        UNITY_FLUSH_CALL();
+        Unity.TestFailures++;
+    }
+    return 1;
+}
+#endif /* UNITY_INCLUDE_FORK_ISOLATION */
+
+void UnityDefaultTestRun(UnityTestFunction Func, const char* FuncName, const int FuncLineNum)
+{
+#ifdef UNITY_USE_COMMAND_LINE_ARGS
+    /* Once the --max-failures budget is spent, every remaining test is
+     * tallied as skipped without running or printing anything. A broken
+     * shared fixture then costs N diagnostics instead of thousands. */
+    if ((UnityMaxFailures > 0U) && (Unity.TestFailures >= UnityMaxFailures))
+    {
+        UnityTestSkips++;
+        return;
+    }
+#endif
+    Unity.CurrentTestName = FuncName;
+    Unity.CurrentTestLineNumber = (UNITY_LINE_TYPE)FuncLineNum;
+    Unity.NumberOfTests++;
+#ifdef UNITY_INCLUDE_FORK_ISOLATION
+    if (UnityForkIsolation && UnityForkAndRunTest(Func))
+    {
+        return;
+    }
+#endif
+    UnityRunSingleTest(Func);
+}
+
+#if defined(UNITY_INCLUDE_TEST_SECTIONS) && defined(__GNUC__)
+/* The linker provides these bounds for the unity_tests section; they are
+ * weak so a harness that registers no tests still links (both resolve to
+ * NULL and the count is zero). */
+extern const UNITY_TEST_DESCRIPTOR_T __start_unity_tests[] __attribute__((weak));
+extern const UNITY_TEST_DESCRIPTOR_T __stop_unity_tests[] __attribute__((weak));
+
+const UNITY_TEST_DESCRIPTOR_T* UnityRegisteredTests(void)
+{
+    return __start_unity_tests;
+}
+
+UNITY_UINT32 UnityRegisteredTestCount(void)
+{
+    return (UNITY_UINT32)(__stop_unity_tests - __start_unity_tests);
+}
+
+int UnityRunRegisteredTests(void)
+{
+    const UNITY_TEST_DESCRIPTOR_T* test;
+
+    for (test = __start_unity_tests; test < __stop_unity_tests; test++)
+    {
+        Unity.TestFile = test->file;
+#ifdef UNITY_USE_COMMAND_LINE_ARGS
+        Unity.CurrentTestName = test->name;
+        if (!UnityTestMatches())
+        {
+            continue;
+        }
+#endif
+        UnityDefaultTestRun(test->func, test->name, test->line);
+    }
+    return (int)Unity.TestFailures;
+}
+#endif /* UNITY_INCLUDE_TEST_SECTIONS */
+
+#ifdef UNITY_INCLUDE_PARALLEL
+/* While a worker is running a test, all Unity output is captured into that
+ * test's shared-memory slot; everywhere else this degrades to putchar. */
+static char* UnityParallelCaptureBuf = NULL;
+static UNITY_UINT32 UnityParallelCaptureLen = 0;
+
+void UnityParallelOutputChar(int ch)
+{
+    if (UnityParallelCaptureBuf != NULL)
+    {
+        if (UnityParallelCaptureLen < (UNITY_UINT32)(UNITY_PARALLEL_MSG_SIZE - 1))
+        {
+            UnityParallelCaptureBuf[UnityParallelCaptureLen++] = (char)ch;
+        }
+    }
+    else
+    {
+        (void)putchar(ch);
+    }
+}
+
+struct UNITY_PARALLEL_SLOT_T
+{
+    volatile int Claimed;
+    volatile int Done;
+    int Failed;
+    int Ignored;
+    UNITY_UINT32 MsgLen;
+    char Msg[UNITY_PARALLEL_MSG_SIZE];
+};
+
+struct UNITY_PARALLEL_SHARED_T
+{
+    struct UNITY_PARALLEL_SLOT_T Slots[1]; /* count slots actually follow */
+};
+
+/*-----------------------------------------------*/
+static void UnityParallelWorkerRunOne(const UNITY_PARALLEL_TEST_T* test,
+                                      struct UNITY_PARALLEL_SLOT_T* slot)
+{
+    UNITY_COUNTER_TYPE failures_before = Unity.TestFailures;
+    UNITY_COUNTER_TYPE ignores_before  = Unity.TestIgnores;
+
+    UnityParallelCaptureBuf = slot->Msg;
+    UnityParallelCaptureLen = 0;
+    Unity.CurrentTestName = test->name;
+    Unity.CurrentTestLineNumber = (UNITY_LINE_TYPE)test->line;
+    UnityRunSingleTest(test->func);
+    slot->Failed  = (Unity.TestFailures != failures_before) ? 1 : 0;
+    slot->Ignored = (Unity.TestIgnores  != ignores_before)  ? 1 : 0;
+    slot->MsgLen  = UnityParallelCaptureLen;
+    UnityParallelCaptureBuf = NULL;
+    slot->Done = 1;
+}
+
+/*-----------------------------------------------*/
+/* Workers claim slots directly with an atomic test-and-set, which
+ * self-balances the load the same way work stealing would without per-worker
+ * deques: an idle worker always takes the next unclaimed test. Claiming is
+ * atomic with selecting the slot, so a worker that crashes mid-test always
+ * leaves its slot Claimed and the parent reports it as a crashed worker
+ * instead of re-running a crashing test in-process. The parent replays the
+ * result slots in registration order once all workers exit. */
+int UnityParallelRun(const UNITY_PARALLEL_TEST_T* tests, UNITY_UINT32 count, unsigned int workers)
+{
+    struct UNITY_PARALLEL_SHARED_T* shared;
+    size_t shared_size;
+    UNITY_UINT32 i;
+    unsigned int w;
+
+    if (count == 0)
+    {
+        return 0;
+    }
+    if (workers < 1)
+    {
+        workers = 1;
+    }
+    if ((UNITY_UINT32)workers > count)
+    {
+        workers = (unsigned int)count;
+    }
+
+    shared_size = sizeof(struct UNITY_PARALLEL_SHARED_T)
+                + ((size_t)count - 1) * sizeof(struct UNITY_PARALLEL_SLOT_T);
+    shared = (struct UNITY_PARALLEL_SHARED_T*)mmap(NULL, shared_size,
+                                                   PROT_READ | PROT_WRITE,
+                                                   MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (shared == MAP_FAILED)
+    {
+        /* No shared memory available: degrade to the sequential runner */
+        for (i = 0; i < count; i++)
+        {
+            UnityDefaultTestRun(tests[i].func, tests[i].name, tests[i].line);
+        }
+        return (int)Unity.TestFailures;
+    }
+
+    UNITY_OUTPUT_FLUSH();
+    (void)fflush(NULL);
+
+    for (w = 0; w < workers; w++)
+    {
+        pid_t child = fork();
+        if (child == 0)
+        {
+            for (i = 0; i < count; i++)
+            {
+                if (__sync_lock_test_and_set(&shared->Slots[i].Claimed, 1))
+                {
+                    continue; /* another worker already owns this slot */
+                }
+                UnityParallelWorkerRunOne(&tests[i], &shared->Slots[i]);
+            }
+            _exit(0);
+        }
+    }
+    while (wait(NULL) > 0) { }
+
+    for (i = 0; i < count; i++)
+    {
+        struct UNITY_PARALLEL_SLOT_T* slot = &shared->Slots[i];
+
+        if (slot->Done)
+        {
+            UNITY_UINT32 c;
+            Unity.NumberOfTests++;
+            Unity.TestFailures += (UNITY_COUNTER_TYPE)slot->Failed;
+            Unity.TestIgnores  += (UNITY_COUNTER_TYPE)slot->Ignored;
+            for (c = 0; c < slot->MsgLen; c++)
+            {
+                UNITY_OUTPUT_CHAR(slot->Msg[c]);
+            }
+        }
+        else if (slot->Claimed)
+        {
+            /* the worker died while running this test */
+            Unity.NumberOfTests++;
+            Unity.CurrentTestName = tests[i].name;
+            Unity.CurrentTestLineNumber = (UNITY_LINE_TYPE)tests[i].line;
+            UnityTestResultsBegin(Unity.TestFile, Unity.CurrentTestLineNumber);
+            UnityPrint(UnityStrFail);
+            UNITY_OUTPUT_CHAR(':');
+            UnityPrint(UnityStrCrashedWorker);
+            UNITY_PRINT_EOL();
+            Unity.TestFailures++;
+        }
+        else
+        {
+            /* never started by any worker (they all exited or died before
+             * reaching this slot): run it here */
+            UnityDefaultTestRun(tests[i].func, tests[i].name, tests[i].line);
+        }
+    }
+    UNITY_FLUSH_CALL();
+
+    (void)munmap(shared, shared_size);
+    return (int)Unity.TestFailures;
+}
+#endif /* UNITY_INCLUDE_PARALLEL */
 #endif
 
 /*-----------------------------------------------*/
@@ -2236,6 +3355,9 @@ void UnityBegin(const char* filename)
 /*-----------------------------------------------*/
 int UnityEnd(void)
 {
+#ifdef UNITY_INCLUDE_SLOW_TEST_REPORT
+    UnitySlowTestReport();
+#endif
     UNITY_PRINT_EOL();
     UnityPrint(UnityStrBreaker);
     UNITY_PRINT_EOL();
@@ -2245,6 +3367,13 @@ int UnityEnd(void)
     UnityPrint(UnityStrResultsFailures);
     UnityPrintNumber((UNITY_INT)(Unity.TestIgnores));
     UnityPrint(UnityStrResultsIgnored);
+#ifdef UNITY_USE_COMMAND_LINE_ARGS
+    if (UnityTestSkips > 0U)
+    {
+        UnityPrintNumber((UNITY_INT)(UnityTestSkips));
+        UnityPrint(UnityStrResultsSkipped);
+    }
+#endif
     UNITY_PRINT_EOL();
     if (Unity.TestFailures == 0U)
     {
@@ -2259,6 +3388,9 @@ int UnityEnd(void)
     }
     UNITY_PRINT_EOL();
     UNITY_FLUSH_CALL();
+#ifdef UNITY_INCLUDE_BINARY_RESULTS
+    UnityBinaryResultsEnd();
+#endif
     UNITY_OUTPUT_COMPLETE();
     return (int)(Unity.TestFailures);
 }
@@ -2272,6 +3404,68 @@ char* UnityOptionIncludeNamed = NULL;
 char* UnityOptionExcludeNamed = NULL;
 int UnityVerbosity            = 1;
 int UnityStrictMatch          = 0;
+int UnityShardIndex           = 0;
+int UnityShardCount           = 0; /* 0 or 1 means sharding is off */
+UNITY_COUNTER_TYPE UnityMaxFailures = 0; /* 0 means no failure budget */
+UNITY_COUNTER_TYPE UnityTestSkips   = 0;
+
+/*-----------------------------------------------*/
+/* Parse the i/n argument of --shard. Returns 0 on success. */
+static int UnityParseShardOption(const char* str)
+{
+    int index = 0;
+    int count = 0;
+
+    if ((*str < '0') || (*str > '9'))
+    {
+        return 1;
+    }
+    while ((*str >= '0') && (*str <= '9'))
+    {
+        index = (index * 10) + (*str++ - '0');
+    }
+    if (*str++ != '/')
+    {
+        return 1;
+    }
+    if ((*str < '0') || (*str > '9'))
+    {
+        return 1;
+    }
+    while ((*str >= '0') && (*str <= '9'))
+    {
+        count = (count * 10) + (*str++ - '0');
+    }
+    if ((*str != 0) || (count < 1) || (index >= count))
+    {
+        return 1;
+    }
+
+    UnityShardIndex = index;
+    UnityShardCount = count;
+    return 0;
+}
+
+/* Filter strings are compiled once into this segment index so that matching a
+ * test is a walk over precomputed segments instead of re-splitting the comma
+ * list for every test. Each segment points into the original argv string. */
+#ifndef UNITY_MAX_TEST_FILTERS
+#define UNITY_MAX_TEST_FILTERS (64)
+#endif
+
+struct UNITY_FILTER_SEGMENT_T
+{
+    const char* pattern;      /* start of this segment in the filter string */
+    const char* test_pattern; /* test part after ':' for file:test segments */
+    int file_match;           /* cached IsStringInBiggerString(TestFile, pattern) */
+};
+
+static struct UNITY_FILTER_SEGMENT_T UnityFilterSegments[UNITY_MAX_TEST_FILTERS];
+static int UnityFilterSegmentCount = 0;
+static int UnityFilterIncludeCount = 0;
+static int UnityFilterOverflow     = 0;
+static int UnityFiltersCompiled    = 0;
+static const char* UnityFilterCachedFile = NULL;
 
 /*-----------------------------------------------*/
 int UnityParseOptions(int argc, char** argv)
@@ -2280,6 +3474,11 @@ int UnityParseOptions(int argc, char** argv)
     UnityOptionIncludeNamed = NULL;
     UnityOptionExcludeNamed = NULL;
     UnityStrictMatch = 0;
+    UnityShardIndex = 0;
+    UnityShardCount = 0;
+    UnityMaxFailures = 0;
+    UnityTestSkips = 0;
+    UnityFiltersCompiled = 0;
 
     for (i = 1; i < argc; i++)
     {
@@ -2329,6 +3528,51 @@ int UnityParseOptions(int argc, char** argv)
                         return 1;
                     }
                     break;
+                case '-': /* long options */
+                    if (strncmp(&argv[i][2], "shard=", 6) == 0)
+                    {
+                        if (UnityParseShardOption(&argv[i][8]) != 0)
+                        {
+                            UnityPrint("ERROR: Shard Option Must Be --shard=i/n With i < n");
+                            UNITY_PRINT_EOL();
+                            return 1;
+                        }
+                        break;
+                    }
+                    if (strncmp(&argv[i][2], "max-failures=", 13) == 0)
+                    {
+                        const char* num = &argv[i][15];
+                        if ((*num < '0') || (*num > '9'))
+                        {
+                            UnityPrint("ERROR: Max Failures Option Must Be --max-failures=N");
+                            UNITY_PRINT_EOL();
+                            return 1;
+                        }
+                        while ((*num >= '0') && (*num <= '9'))
+                        {
+                            UnityMaxFailures = (UnityMaxFailures * 10) + (UNITY_COUNTER_TYPE)(*num++ - '0');
+                        }
+                        if (*num != 0)
+                        {
+                            UnityPrint("ERROR: Max Failures Option Must Be --max-failures=N");
+                            UNITY_PRINT_EOL();
+                            return 1;
+                        }
+                        break;
+                    }
+#ifdef UNITY_INCLUDE_BINARY_RESULTS
+                    if (strncmp(&argv[i][2], "binary-out=", 11) == 0)
+                    {
+                        if (UnityBinaryResultsOpen(&argv[i][13]) != 0)
+                        {
+                            UnityPrint("ERROR: Cannot Open Binary Results File");
+                            UNITY_PRINT_EOL();
+                            return 1;
+                        }
+                        break;
+                    }
+#endif
+                    /* FALLTHRU */
                 default:
                     UnityPrint("ERROR: Unknown Option ");
                     UNITY_OUTPUT_CHAR(argv[i][1]);
@@ -2344,6 +3588,11 @@ int UnityParseOptions(int argc, char** argv)
                     UnityPrint("-q        Quiet/decrease verbosity"); UNITY_PRINT_EOL();
                     UnityPrint("-v        increase Verbosity"); UNITY_PRINT_EOL();
                     UnityPrint("-x NAME   eXclude tests whose name includes NAME"); UNITY_PRINT_EOL();
+                    UnityPrint("--shard=i/n  run only the i-th (0-based) of n deterministic shards"); UNITY_PRINT_EOL();
+                    UnityPrint("--max-failures=N  skip all remaining tests once N have failed"); UNITY_PRINT_EOL();
+#ifdef UNITY_INCLUDE_BINARY_RESULTS
+                    UnityPrint("--binary-out=FILE  also write compact binary result records to FILE"); UNITY_PRINT_EOL();
+#endif
                     UNITY_OUTPUT_FLUSH();
                     return 1;
             }
@@ -2471,14 +3720,168 @@ static int UnityStringArgumentMatches(const char* str)
     return 0;
 }
 
+/*-----------------------------------------------*/
+/* Split one filter string into segments, using the same quote/comma/colon
+ * rules as UnityStringArgumentMatches. Segments beyond the index capacity
+ * set the overflow flag, which switches matching back to the full rescan. */
+static void UnityCompileFilterString(const char* str)
+{
+    const char* ptr1;
+    const char* ptr2;
+    const char* ptrf;
+
+    if (str == NULL)
+    {
+        return;
+    }
+
+    ptr1 = str;
+    while (ptr1[0] != 0)
+    {
+        if ((ptr1[0] == '"') || (ptr1[0] == '\''))
+        {
+            ptr1++;
+        }
+
+        /* look for the start of the next partial */
+        ptr2 = ptr1;
+        ptrf = 0;
+        do
+        {
+            ptr2++;
+            if ((ptr2[0] == ':') && (ptr2[1] != 0) && (ptr2[0] != '\'') && (ptr2[0] != '"') && (ptr2[0] != ','))
+            {
+                ptrf = &ptr2[1];
+            }
+        } while ((ptr2[0] != 0) && (ptr2[0] != '\'') && (ptr2[0] != '"') && (ptr2[0] != ','));
+
+        while ((ptr2[0] != 0) && ((ptr2[0] == ':') || (ptr2[0] == '\'') || (ptr2[0] == '"') || (ptr2[0] == ',')))
+        {
+            ptr2++;
+        }
+
+        if (UnityFilterSegmentCount < UNITY_MAX_TEST_FILTERS)
+        {
+            UnityFilterSegments[UnityFilterSegmentCount].pattern = ptr1;
+            UnityFilterSegments[UnityFilterSegmentCount].test_pattern = ptrf;
+            UnityFilterSegments[UnityFilterSegmentCount].file_match = 0;
+            UnityFilterSegmentCount++;
+        }
+        else
+        {
+            UnityFilterOverflow = 1;
+        }
+
+        ptr1 = ptr2;
+    }
+}
+
+/*-----------------------------------------------*/
+static void UnityCompileFilters(void)
+{
+    UnityFilterSegmentCount = 0;
+    UnityFilterOverflow = 0;
+    UnityCompileFilterString(UnityOptionIncludeNamed);
+    UnityFilterIncludeCount = UnityFilterSegmentCount;
+    UnityCompileFilterString(UnityOptionExcludeNamed);
+    UnityFilterCachedFile = NULL;
+    UnityFiltersCompiled = 1;
+}
+
+/*-----------------------------------------------*/
+static int UnityFilterSegmentMatches(const struct UNITY_FILTER_SEGMENT_T* seg)
+{
+    /* done if complete filename match (cached per test file) */
+    if (seg->file_match == 1)
+    {
+        return 1;
+    }
+
+    /* done if testname match after filename partial match */
+    if ((seg->file_match == 2) && (seg->test_pattern != 0))
+    {
+        if (IsStringInBiggerString(Unity.CurrentTestName, seg->test_pattern))
+        {
+            return 1;
+        }
+    }
+
+    /* done if complete testname match */
+    if (IsStringInBiggerString(Unity.CurrentTestName, seg->pattern) == 1)
+    {
+        return 1;
+    }
+
+    return 0;
+}
+
 /*-----------------------------------------------*/
 int UnityTestMatches(void)
 {
-    /* Check if this test name matches the included test pattern */
     int retval;
-    if (UnityOptionIncludeNamed)
+    int i;
+
+    /* Sharding assigns every test to exactly one of n shards by name hash,
+     * so all shards agree on the split without seeing each other. */
+    if (UnityShardCount > 1)
+    {
+        UNITY_UINT32 hash = 2166136261u; /* FNV-1a */
+        const char* pch = Unity.CurrentTestName;
+        while (*pch)
+        {
+            hash ^= (UNITY_UINT32)(unsigned char)*pch++;
+            hash *= 16777619u;
+        }
+        if ((int)(hash % (UNITY_UINT32)UnityShardCount) != UnityShardIndex)
+        {
+            return 0;
+        }
+    }
+
+    if (!UnityFiltersCompiled)
     {
-        retval = UnityStringArgumentMatches(UnityOptionIncludeNamed);
+        UnityCompileFilters();
+    }
+
+    if (UnityFilterOverflow)
+    {
+        /* more segments than the index holds: rescan the raw filter strings */
+        if (UnityOptionIncludeNamed)
+        {
+            retval = UnityStringArgumentMatches(UnityOptionIncludeNamed);
+        }
+        else
+        {
+            retval = 1;
+        }
+        if (UnityOptionExcludeNamed)
+        {
+            if (UnityStringArgumentMatches(UnityOptionExcludeNamed))
+            {
+                retval = 0;
+            }
+        }
+        return retval;
+    }
+
+    /* the filename-side results only change when the test file does */
+    if (Unity.TestFile != UnityFilterCachedFile)
+    {
+        for (i = 0; i < UnityFilterSegmentCount; i++)
+        {
+            UnityFilterSegments[i].file_match = IsStringInBiggerString(Unity.TestFile, UnityFilterSegments[i].pattern);
+        }
+        UnityFilterCachedFile = Unity.TestFile;
+    }
+
+    /* Check if this test name matches the included test pattern */
+    if (UnityFilterIncludeCount > 0)
+    {
+        retval = 0;
+        for (i = 0; (i < UnityFilterIncludeCount) && !retval; i++)
+        {
+            retval = UnityFilterSegmentMatches(&UnityFilterSegments[i]);
+        }
     }
     else
     {
@@ -2486,11 +3889,15 @@ int UnityTestMatches(void)
     }
 
     /* Check if this test name matches the excluded test pattern */
-    if (UnityOptionExcludeNamed)
+    if (retval)
     {
-        if (UnityStringArgumentMatches(UnityOptionExcludeNamed))
+        for (i = UnityFilterIncludeCount; i < UnityFilterSegmentCount; i++)
         {
-            retval = 0;
+            if (UnityFilterSegmentMatches(&UnityFilterSegments[i]))
+            {
+                retval = 0;
+                break;
+            }
         }
     }
 
@@ -669,6 +669,12 @@ void verifyTest(void);
 #define TEST_ASSERT_DOUBLE_IS_NOT_NAN_MESSAGE(actual, message)                                     UNITY_TEST_ASSERT_DOUBLE_IS_NOT_NAN((actual), __LINE__, (message))
 #define TEST_ASSERT_DOUBLE_IS_NOT_DETERMINATE_MESSAGE(actual, message)                             UNITY_TEST_ASSERT_DOUBLE_IS_NOT_DETERMINATE((actual), __LINE__, (message))
 
+/* Expectation Set (bulk assertion of incrementally computed elements) */
+#ifdef UNITY_INCLUDE_EXPECT_SET
+#define TEST_EXPECT_EQUAL_INT(expected, actual)                                                    UnityExpectEqualNumber((UNITY_INT)(expected), (UNITY_INT)(actual), (UNITY_LINE_TYPE)__LINE__)
+#define TEST_ASSERT_EXPECTATIONS()                                                                 UnityVerifyExpectations((UNITY_LINE_TYPE)__LINE__)
+#endif
+
 /* Shorthand */
 #ifdef UNITY_SHORTHAND_AS_OLD
 #define TEST_ASSERT_EQUAL_MESSAGE(expected, actual, message)                                       UNITY_TEST_ASSERT_EQUAL_INT((expected), (actual), __LINE__, (message))
@@ -12,6 +12,14 @@
 #include "unity_config.h"
 #endif
 
+/* Selecting the abort-flag protection mode removes the per-test setjmp
+ * entirely: TEST_ABORT() raises the fail/ignore flags and returns, and test
+ * bodies bail out at TEST_ABORT_CHECK() points instead of longjmp-ing.
+ * Implies UNITY_EXCLUDE_SETJMP_H so no jmp_buf is stored or saved. */
+#if defined(UNITY_USE_ABORT_FLAG) && !defined(UNITY_EXCLUDE_SETJMP_H)
+#define UNITY_EXCLUDE_SETJMP_H
+#endif
+
 #ifndef UNITY_EXCLUDE_SETJMP_H
 #include <setjmp.h>
 #endif
@@ -321,6 +329,56 @@ typedef UNITY_FLOAT_TYPE UNITY_FLOAT;
 
 #endif
 
+/*-------------------------------------------------------
+ * Output Method: parallel worker capture (OPTIONAL)
+ *-------------------------------------------------------*/
+/* The parallel scheduler routes output through this hook so that a worker
+ * process can capture the result lines of the test it is currently running
+ * into that test's shared-memory slot. Outside of a worker it degrades to
+ * plain putchar. See UnityParallelRun below. */
+#ifdef UNITY_INCLUDE_PARALLEL
+  #include <stdio.h>
+  #ifndef UNITY_PARALLEL_MSG_SIZE
+  #define UNITY_PARALLEL_MSG_SIZE (512)
+  #endif
+  void UnityParallelOutputChar(int ch);
+  #ifndef UNITY_OUTPUT_CHAR
+  #define UNITY_OUTPUT_CHAR(a) UnityParallelOutputChar(a)
+  #endif
+#endif
+
+/*-------------------------------------------------------
+ * Output Method: buffered sink (OPTIONAL)
+ *-------------------------------------------------------*/
+/* When enabled, single-character output is collected into an internal buffer
+ * which is flushed at the explicit flush points (end of each test result line
+ * and the final summary) instead of paying one libc call per character. A
+ * whole-buffer write callback may be registered to replace the default
+ * stdout backend entirely. */
+/* Capturing code-under-test output needs the buffered sink, since Unity's
+ * own result stream must be handed over whole buffers to bypass the
+ * redirected file descriptors. */
+#if defined(UNITY_INCLUDE_OUTPUT_CAPTURE) && !defined(UNITY_OUTPUT_BUFFERED)
+#define UNITY_OUTPUT_BUFFERED
+#endif
+
+#ifdef UNITY_OUTPUT_BUFFERED
+  #include <stdio.h>
+  #ifndef UNITY_OUTPUT_BUFFER_SIZE
+  #define UNITY_OUTPUT_BUFFER_SIZE (4096)
+  #endif
+  typedef void (*UNITY_OUTPUT_WRITE_T)(const char* buffer, UNITY_UINT32 length);
+  void UnityOutputBufferChar(int ch);
+  void UnityOutputBufferFlush(void);
+  void UnitySetOutputWriteFunction(UNITY_OUTPUT_WRITE_T writeFunction);
+  #ifndef UNITY_OUTPUT_CHAR
+  #define UNITY_OUTPUT_CHAR(a) UnityOutputBufferChar(a)
+  #endif
+  #ifndef UNITY_OUTPUT_FLUSH
+  #define UNITY_OUTPUT_FLUSH() UnityOutputBufferFlush()
+  #endif
+#endif
+
 /*-------------------------------------------------------
  * Output Method: stdout (DEFAULT)
  *-------------------------------------------------------*/
@@ -369,6 +427,16 @@ typedef UNITY_FLOAT_TYPE UNITY_FLOAT;
 #define UNITY_OUTPUT_COMPLETE()
 #endif
 
+/* The slow-test report needs per-test timings, so it pulls them in. */
+#ifdef UNITY_INCLUDE_SLOW_TEST_REPORT
+  #ifndef UNITY_INCLUDE_EXEC_TIME
+  #define UNITY_INCLUDE_EXEC_TIME
+  #endif
+  #ifndef UNITY_SLOW_TEST_REPORT_SIZE
+  #define UNITY_SLOW_TEST_REPORT_SIZE (10)
+  #endif
+#endif
+
 #ifdef UNITY_INCLUDE_EXEC_TIME
   #if !defined(UNITY_EXEC_TIME_START) && \
       !defined(UNITY_EXEC_TIME_STOP) && \
@@ -381,6 +449,7 @@ typedef UNITY_FLOAT_TYPE UNITY_FLOAT;
       #define UNITY_TIME_TYPE UNITY_UINT
       #define UNITY_EXEC_TIME_START() Unity.CurrentTestStartTime = UNITY_CLOCK_MS()
       #define UNITY_EXEC_TIME_STOP() Unity.CurrentTestStopTime = UNITY_CLOCK_MS()
+      #define UNITY_EXEC_TIME_ELAPSED_MS() ((UNITY_UINT)(Unity.CurrentTestStopTime - Unity.CurrentTestStartTime))
       #define UNITY_PRINT_EXEC_TIME() { \
         UNITY_UINT execTimeMs = (Unity.CurrentTestStopTime - Unity.CurrentTestStartTime); \
         UnityPrint(" ("); \
@@ -393,6 +462,7 @@ typedef UNITY_FLOAT_TYPE UNITY_FLOAT;
       #define UNITY_GET_TIME(t) t = (clock_t)((clock() * 1000) / CLOCKS_PER_SEC)
       #define UNITY_EXEC_TIME_START() UNITY_GET_TIME(Unity.CurrentTestStartTime)
       #define UNITY_EXEC_TIME_STOP() UNITY_GET_TIME(Unity.CurrentTestStopTime)
+      #define UNITY_EXEC_TIME_ELAPSED_MS() ((UNITY_UINT)(Unity.CurrentTestStopTime - Unity.CurrentTestStartTime))
       #define UNITY_PRINT_EXEC_TIME() { \
         UNITY_UINT execTimeMs = (Unity.CurrentTestStopTime - Unity.CurrentTestStartTime); \
         UnityPrint(" ("); \
@@ -405,6 +475,8 @@ typedef UNITY_FLOAT_TYPE UNITY_FLOAT;
       #define UNITY_GET_TIME(t) clock_gettime(CLOCK_MONOTONIC, &t)
       #define UNITY_EXEC_TIME_START() UNITY_GET_TIME(Unity.CurrentTestStartTime)
       #define UNITY_EXEC_TIME_STOP() UNITY_GET_TIME(Unity.CurrentTestStopTime)
+      #define UNITY_EXEC_TIME_ELAPSED_MS() ((UNITY_UINT)(((Unity.CurrentTestStopTime.tv_sec - Unity.CurrentTestStartTime.tv_sec) * 1000L) + \
+                                            ((Unity.CurrentTestStopTime.tv_nsec - Unity.CurrentTestStartTime.tv_nsec) / 1000000L)))
       #define UNITY_PRINT_EXEC_TIME() { \
         UNITY_UINT execTimeMs = ((Unity.CurrentTestStopTime.tv_sec - Unity.CurrentTestStartTime.tv_sec) * 1000L); \
         execTimeMs += ((Unity.CurrentTestStopTime.tv_nsec - Unity.CurrentTestStartTime.tv_nsec) / 1000000L); \
@@ -432,6 +504,10 @@ typedef UNITY_FLOAT_TYPE UNITY_FLOAT;
 #define UNITY_PRINT_EXEC_TIME() do { /* nothing*/ } while (0)
 #endif
 
+#ifndef UNITY_EXEC_TIME_ELAPSED_MS
+#define UNITY_EXEC_TIME_ELAPSED_MS() ((UNITY_UINT)0)
+#endif
+
 /*-------------------------------------------------------
  * Footprint
  *-------------------------------------------------------*/
@@ -540,7 +616,27 @@ struct UNITY_STORAGE_T
 #endif
 };
 
+/* Defining UNITY_INCLUDE_CONTEXT makes the runtime reentrant: every use of
+ * Unity goes through a thread-local context pointer instead of one global
+ * struct, so a thread pool can run tests in-process by binding each worker
+ * its own UNITY_STORAGE_T with UnitySetContext(). The default context keeps
+ * single-threaded source compatibility -- without a call to UnitySetContext()
+ * behavior is unchanged, and passing NULL rebinds the default. */
+#ifdef UNITY_INCLUDE_CONTEXT
+  #if defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L && !defined(__STDC_NO_THREADS__)
+    #define UNITY_THREAD_LOCAL _Thread_local
+  #elif defined(__GNUC__) || defined(__clang__)
+    #define UNITY_THREAD_LOCAL __thread
+  #else
+    #define UNITY_THREAD_LOCAL /* single context only */
+  #endif
+extern UNITY_THREAD_LOCAL struct UNITY_STORAGE_T* UnityContextPointer;
+void UnitySetContext(struct UNITY_STORAGE_T* context);
+struct UNITY_STORAGE_T* UnityGetContext(void);
+#define Unity (*UnityContextPointer)
+#else
 extern struct UNITY_STORAGE_T Unity;
+#endif
 
 /*-------------------------------------------------------
  * Test Suite Management
@@ -557,6 +653,85 @@ void UnityDefaultTestRun(UnityTestFunction Func, const char* FuncName, const int
 #define UNITY_SKIP_DEFAULT_RUNNER
 #endif
 
+/* Fork-per-test isolation (POSIX only): each test runs in a forked child so
+ * a segfault in the code under test only loses that test slot instead of the
+ * whole harness. Opt in with UNITY_INCLUDE_FORK_ISOLATION; the runtime toggle
+ * below (default on when compiled in) allows disabling it under a debugger. */
+#if defined(UNITY_INCLUDE_FORK_ISOLATION) && !defined(UNITY_SKIP_DEFAULT_RUNNER)
+extern int UnityForkIsolation;
+#endif
+
+/* Per-test watchdog timeout (POSIX alarm/SIGALRM, needs setjmp). A test
+ * still running when the alarm fires is marked failed with a TIMEOUT line
+ * and the harness continues. Override UNITY_TEST_TIMEOUT_SECONDS or assign
+ * the global at runtime; values <= 0 disable the watchdog. */
+#if defined(UNITY_INCLUDE_TEST_TIMEOUT) && !defined(UNITY_EXCLUDE_SETJMP_H)
+extern int UnityTestTimeoutSeconds;
+#endif
+
+/* stdout/stderr capture around each test (POSIX only): output from the code
+ * under test is swallowed on pass and replayed into the diagnostics on
+ * failure. Opt in with UNITY_INCLUDE_OUTPUT_CAPTURE; the runtime toggle
+ * (default on when compiled in) allows letting output through temporarily. */
+#if defined(UNITY_INCLUDE_OUTPUT_CAPTURE) && !defined(UNITY_SKIP_DEFAULT_RUNNER)
+extern int UnityOutputCapture;
+#endif
+
+/* Linker-section test registration (GCC/Clang on ELF targets): instead of a
+ * generated main() with one RUN_TEST call site per test, each test places a
+ * descriptor into the unity_tests section with UNITY_REGISTER_TEST and the
+ * runner iterates the resulting contiguous array. A flat descriptor array
+ * makes counting, sharding and filtered iteration over tens of thousands of
+ * tests a cache-friendly loop, and adding or removing a test no longer
+ * touches main(). Opt in with UNITY_INCLUDE_TEST_SECTIONS. */
+#if defined(UNITY_INCLUDE_TEST_SECTIONS) && defined(__GNUC__) && !defined(UNITY_SKIP_DEFAULT_RUNNER)
+typedef struct UNITY_TEST_DESCRIPTOR_T
+{
+    UnityTestFunction func;
+    const char* name;
+    const char* file;
+    int line;
+} UNITY_TEST_DESCRIPTOR_T;
+
+#define UNITY_REGISTER_TEST(fn)                                                 \
+    static const UNITY_TEST_DESCRIPTOR_T UnityTestDescriptor_##fn               \
+    __attribute__((used, section("unity_tests"), aligned(sizeof(void*)))) =     \
+        { fn, #fn, __FILE__, __LINE__ }
+
+const UNITY_TEST_DESCRIPTOR_T* UnityRegisteredTests(void);
+UNITY_UINT32 UnityRegisteredTestCount(void);
+int UnityRunRegisteredTests(void);
+#endif
+
+/* Binary result stream: when UNITY_INCLUDE_BINARY_RESULTS is defined, a
+ * compact length-prefixed record per test (file id, line, status, duration,
+ * name) can be written to a side file instead of having CI regex-parse the
+ * text protocol. The stream is selected at runtime with --binary-out=FILE
+ * (requires UNITY_USE_COMMAND_LINE_ARGS) or by calling the open function
+ * below before UnityBegin; while active, passing tests emit no text line. */
+#ifdef UNITY_INCLUDE_BINARY_RESULTS
+int UnityBinaryResultsOpen(const char* path);
+#endif
+
+/* Parallel scheduler (POSIX only): registered tests are placed in a shared
+ * queue and claimed dynamically by a pool of forked workers, so long tests
+ * do not serialize behind short ones. Each worker captures the output of the
+ * test it is running into that test's shared-memory slot; the parent replays
+ * the slots in registration order, so the final report is deterministic and
+ * diffable against sequential runs. Opt in with UNITY_INCLUDE_PARALLEL. */
+#if defined(UNITY_INCLUDE_PARALLEL) && !defined(UNITY_SKIP_DEFAULT_RUNNER)
+typedef struct UNITY_PARALLEL_TEST_T
+{
+    UnityTestFunction func;
+    const char* name;
+    int line;
+} UNITY_PARALLEL_TEST_T;
+
+#define UNITY_PARALLEL_TEST(fn) { (fn), #fn, __LINE__ }
+
+int UnityParallelRun(const UNITY_PARALLEL_TEST_T* tests, UNITY_UINT32 count, unsigned int workers);
+#endif
+
 /*-------------------------------------------------------
  * Details Support
  *-------------------------------------------------------*/
@@ -691,6 +866,20 @@ void UnityIgnore(const char* message, const UNITY_LINE_TYPE line);
 
 void UnityMessage(const char* message, const UNITY_LINE_TYPE line);
 
+/* Expectation set (opt in with UNITY_INCLUDE_EXPECT_SET): accumulate
+ * (expected, actual) records into a preallocated arena and verify them in one
+ * pass at a single assert point, reporting the first divergent record with
+ * its index. For loops that compute elements incrementally and cannot form
+ * the two contiguous arrays UnityAssertEqualIntArray wants. When the arena
+ * fills, records verified so far are flushed and indices keep counting. */
+#ifdef UNITY_INCLUDE_EXPECT_SET
+#ifndef UNITY_EXPECT_SET_SIZE
+#define UNITY_EXPECT_SET_SIZE (256)
+#endif
+void UnityExpectEqualNumber(const UNITY_INT expected, const UNITY_INT actual, const UNITY_LINE_TYPE lineNumber);
+void UnityVerifyExpectations(const UNITY_LINE_TYPE lineNumber);
+#endif
+
 #ifndef UNITY_EXCLUDE_FLOAT
 void UnityAssertFloatsWithin(const UNITY_FLOAT delta,
                              const UNITY_FLOAT expected,
@@ -807,6 +996,18 @@ extern const char UnityStrErrShorthand[];
 #endif
 #endif
 
+/* With UNITY_USE_ABORT_FLAG a failing assertion can only return from the
+ * function it was written in, so anything that runs after it is stopped by
+ * re-checking the fail/ignore flags at explicit return points. It is the
+ * test author's responsibility to place one after any statement that may
+ * assert (typically after each helper call that contains assertions); in
+ * the setjmp modes the macro compiles away to nothing. */
+#ifdef UNITY_USE_ABORT_FLAG
+#define TEST_ABORT_CHECK() do { if (Unity.CurrentTestFailed || Unity.CurrentTestIgnored) return; } while (0)
+#else
+#define TEST_ABORT_CHECK() do { } while (0)
+#endif
+
 /* Automatically enable variadic macros support, if it not enabled before */
 #ifndef UNITY_SUPPORT_VARIADIC_MACROS
   #ifdef __STDC_VERSION__
@@ -880,6 +1081,8 @@ extern const char UnityStrErrShorthand[];
 #ifdef UNITY_USE_COMMAND_LINE_ARGS
 int UnityParseOptions(int argc, char** argv);
 int UnityTestMatches(void);
+extern UNITY_COUNTER_TYPE UnityMaxFailures; /* --max-failures=N budget, 0 = no limit */
+extern UNITY_COUNTER_TYPE UnityTestSkips;   /* tests skipped after the budget was spent */
 #endif
 
 /*-------------------------------------------------------
@@ -899,18 +1102,38 @@ int UnityTestMatches(void);
 #define UNITY_TEST_ASSERT_EMPTY(pointer, line, message)                                          UNITY_TEST_ASSERT(((pointer[0]) == 0),  (line), (message))
 #define UNITY_TEST_ASSERT_NOT_EMPTY(pointer, line, message)                                      UNITY_TEST_ASSERT(((pointer[0]) != 0),  (line), (message))
 
-#define UNITY_TEST_ASSERT_EQUAL_INT(expected, actual, line, message)                             UnityAssertEqualNumber((UNITY_INT)(expected), (UNITY_INT)(actual), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_INT)
-#define UNITY_TEST_ASSERT_EQUAL_INT8(expected, actual, line, message)                            UnityAssertEqualNumber((UNITY_INT)(UNITY_INT8 )(expected), (UNITY_INT)(UNITY_INT8 )(actual), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_INT8)
-#define UNITY_TEST_ASSERT_EQUAL_INT16(expected, actual, line, message)                           UnityAssertEqualNumber((UNITY_INT)(UNITY_INT16)(expected), (UNITY_INT)(UNITY_INT16)(actual), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_INT16)
-#define UNITY_TEST_ASSERT_EQUAL_INT32(expected, actual, line, message)                           UnityAssertEqualNumber((UNITY_INT)(UNITY_INT32)(expected), (UNITY_INT)(UNITY_INT32)(actual), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_INT32)
-#define UNITY_TEST_ASSERT_EQUAL_UINT(expected, actual, line, message)                            UnityAssertEqualNumber((UNITY_INT)(expected), (UNITY_INT)(actual), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_UINT)
-#define UNITY_TEST_ASSERT_EQUAL_UINT8(expected, actual, line, message)                           UnityAssertEqualNumber((UNITY_INT)(UNITY_UINT8 )(expected), (UNITY_INT)(UNITY_UINT8 )(actual), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_UINT8)
-#define UNITY_TEST_ASSERT_EQUAL_UINT16(expected, actual, line, message)                          UnityAssertEqualNumber((UNITY_INT)(UNITY_UINT16)(expected), (UNITY_INT)(UNITY_UINT16)(actual), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_UINT16)
-#define UNITY_TEST_ASSERT_EQUAL_UINT32(expected, actual, line, message)                          UnityAssertEqualNumber((UNITY_INT)(UNITY_UINT32)(expected), (UNITY_INT)(UNITY_UINT32)(actual), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_UINT32)
-#define UNITY_TEST_ASSERT_EQUAL_HEX8(expected, actual, line, message)                            UnityAssertEqualNumber((UNITY_INT)(UNITY_INT8 )(expected), (UNITY_INT)(UNITY_INT8 )(actual), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_HEX8)
-#define UNITY_TEST_ASSERT_EQUAL_HEX16(expected, actual, line, message)                           UnityAssertEqualNumber((UNITY_INT)(UNITY_INT16)(expected), (UNITY_INT)(UNITY_INT16)(actual), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_HEX16)
-#define UNITY_TEST_ASSERT_EQUAL_HEX32(expected, actual, line, message)                           UnityAssertEqualNumber((UNITY_INT)(UNITY_INT32)(expected), (UNITY_INT)(UNITY_INT32)(actual), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_HEX32)
-#define UNITY_TEST_ASSERT_EQUAL_CHAR(expected, actual, line, message)                            UnityAssertEqualNumber((UNITY_INT)(UNITY_INT8 )(expected), (UNITY_INT)(UNITY_INT8 )(actual), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_CHAR)
+/* All scalar equality assertions funnel through this macro. By default it
+ * calls straight into UnityAssertEqualNumber; defining
+ * UNITY_INCLUDE_FAST_ASSERTS compares the already-converted values inline
+ * instead, so the passing path is a compare and the style dispatch in the
+ * helper (only needed to format a failure) is reached purely on mismatch.
+ * The temporaries keep expected/actual single-evaluation either way. */
+#ifdef UNITY_INCLUDE_FAST_ASSERTS
+#define UNITY_TEST_ASSERT_EQUAL_NUMBER(expected, actual, line, message, style) \
+    do { \
+        const UNITY_INT unity_eq_expected = (expected); \
+        const UNITY_INT unity_eq_actual = (actual); \
+        if (unity_eq_expected != unity_eq_actual) \
+        { \
+            UnityAssertEqualNumber(unity_eq_expected, unity_eq_actual, (message), (UNITY_LINE_TYPE)(line), (style)); \
+        } \
+    } while (0)
+#else
+#define UNITY_TEST_ASSERT_EQUAL_NUMBER(expected, actual, line, message, style)                   UnityAssertEqualNumber((expected), (actual), (message), (UNITY_LINE_TYPE)(line), (style))
+#endif
+
+#define UNITY_TEST_ASSERT_EQUAL_INT(expected, actual, line, message)                             UNITY_TEST_ASSERT_EQUAL_NUMBER((UNITY_INT)(expected), (UNITY_INT)(actual), (line), (message), UNITY_DISPLAY_STYLE_INT)
+#define UNITY_TEST_ASSERT_EQUAL_INT8(expected, actual, line, message)                            UNITY_TEST_ASSERT_EQUAL_NUMBER((UNITY_INT)(UNITY_INT8 )(expected), (UNITY_INT)(UNITY_INT8 )(actual), (line), (message), UNITY_DISPLAY_STYLE_INT8)
+#define UNITY_TEST_ASSERT_EQUAL_INT16(expected, actual, line, message)                           UNITY_TEST_ASSERT_EQUAL_NUMBER((UNITY_INT)(UNITY_INT16)(expected), (UNITY_INT)(UNITY_INT16)(actual), (line), (message), UNITY_DISPLAY_STYLE_INT16)
+#define UNITY_TEST_ASSERT_EQUAL_INT32(expected, actual, line, message)                           UNITY_TEST_ASSERT_EQUAL_NUMBER((UNITY_INT)(UNITY_INT32)(expected), (UNITY_INT)(UNITY_INT32)(actual), (line), (message), UNITY_DISPLAY_STYLE_INT32)
+#define UNITY_TEST_ASSERT_EQUAL_UINT(expected, actual, line, message)                            UNITY_TEST_ASSERT_EQUAL_NUMBER((UNITY_INT)(expected), (UNITY_INT)(actual), (line), (message), UNITY_DISPLAY_STYLE_UINT)
+#define UNITY_TEST_ASSERT_EQUAL_UINT8(expected, actual, line, message)                           UNITY_TEST_ASSERT_EQUAL_NUMBER((UNITY_INT)(UNITY_UINT8 )(expected), (UNITY_INT)(UNITY_UINT8 )(actual), (line), (message), UNITY_DISPLAY_STYLE_UINT8)
+#define UNITY_TEST_ASSERT_EQUAL_UINT16(expected, actual, line, message)                          UNITY_TEST_ASSERT_EQUAL_NUMBER((UNITY_INT)(UNITY_UINT16)(expected), (UNITY_INT)(UNITY_UINT16)(actual), (line), (message), UNITY_DISPLAY_STYLE_UINT16)
+#define UNITY_TEST_ASSERT_EQUAL_UINT32(expected, actual, line, message)                          UNITY_TEST_ASSERT_EQUAL_NUMBER((UNITY_INT)(UNITY_UINT32)(expected), (UNITY_INT)(UNITY_UINT32)(actual), (line), (message), UNITY_DISPLAY_STYLE_UINT32)
+#define UNITY_TEST_ASSERT_EQUAL_HEX8(expected, actual, line, message)                            UNITY_TEST_ASSERT_EQUAL_NUMBER((UNITY_INT)(UNITY_INT8 )(expected), (UNITY_INT)(UNITY_INT8 )(actual), (line), (message), UNITY_DISPLAY_STYLE_HEX8)
+#define UNITY_TEST_ASSERT_EQUAL_HEX16(expected, actual, line, message)                           UNITY_TEST_ASSERT_EQUAL_NUMBER((UNITY_INT)(UNITY_INT16)(expected), (UNITY_INT)(UNITY_INT16)(actual), (line), (message), UNITY_DISPLAY_STYLE_HEX16)
+#define UNITY_TEST_ASSERT_EQUAL_HEX32(expected, actual, line, message)                           UNITY_TEST_ASSERT_EQUAL_NUMBER((UNITY_INT)(UNITY_INT32)(expected), (UNITY_INT)(UNITY_INT32)(actual), (line), (message), UNITY_DISPLAY_STYLE_HEX32)
+#define UNITY_TEST_ASSERT_EQUAL_CHAR(expected, actual, line, message)                            UNITY_TEST_ASSERT_EQUAL_NUMBER((UNITY_INT)(UNITY_INT8 )(expected), (UNITY_INT)(UNITY_INT8 )(actual), (line), (message), UNITY_DISPLAY_STYLE_CHAR)
 #define UNITY_TEST_ASSERT_BITS(mask, expected, actual, line, message)                            UnityAssertBits((UNITY_INT)(mask), (UNITY_INT)(expected), (UNITY_INT)(actual), (message), (UNITY_LINE_TYPE)(line))
 
 #define UNITY_TEST_ASSERT_NOT_EQUAL_INT(threshold, actual, line, message)                        UnityAssertGreaterOrLessOrEqualNumber((UNITY_INT)(threshold),               (UNITY_INT)(actual),               UNITY_NOT_EQUAL, (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_INT)
@@ -1043,9 +1266,9 @@ int UnityTestMatches(void);
 #define UNITY_TEST_ASSERT_EACH_EQUAL_CHAR(expected, actual, num_elements, line, message)         UnityAssertEqualIntArray(UnityNumToPtr((UNITY_INT)(UNITY_INT8  )(expected), 1),                              (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_CHAR,    UNITY_ARRAY_TO_VAL)
 
 #ifdef UNITY_SUPPORT_64
-#define UNITY_TEST_ASSERT_EQUAL_INT64(expected, actual, line, message)                           UnityAssertEqualNumber((UNITY_INT)(expected), (UNITY_INT)(actual), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_INT64)
-#define UNITY_TEST_ASSERT_EQUAL_UINT64(expected, actual, line, message)                          UnityAssertEqualNumber((UNITY_INT)(expected), (UNITY_INT)(actual), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_UINT64)
-#define UNITY_TEST_ASSERT_EQUAL_HEX64(expected, actual, line, message)                           UnityAssertEqualNumber((UNITY_INT)(expected), (UNITY_INT)(actual), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_HEX64)
+#define UNITY_TEST_ASSERT_EQUAL_INT64(expected, actual, line, message)                           UNITY_TEST_ASSERT_EQUAL_NUMBER((UNITY_INT)(expected), (UNITY_INT)(actual), (line), (message), UNITY_DISPLAY_STYLE_INT64)
+#define UNITY_TEST_ASSERT_EQUAL_UINT64(expected, actual, line, message)                          UNITY_TEST_ASSERT_EQUAL_NUMBER((UNITY_INT)(expected), (UNITY_INT)(actual), (line), (message), UNITY_DISPLAY_STYLE_UINT64)
+#define UNITY_TEST_ASSERT_EQUAL_HEX64(expected, actual, line, message)                           UNITY_TEST_ASSERT_EQUAL_NUMBER((UNITY_INT)(expected), (UNITY_INT)(actual), (line), (message), UNITY_DISPLAY_STYLE_HEX64)
 #define UNITY_TEST_ASSERT_EQUAL_INT64_ARRAY(expected, actual, num_elements, line, message)       UnityAssertEqualIntArray((UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_INT64,  UNITY_ARRAY_TO_ARRAY)
 #define UNITY_TEST_ASSERT_EQUAL_UINT64_ARRAY(expected, actual, num_elements, line, message)      UnityAssertEqualIntArray((UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_UINT64, UNITY_ARRAY_TO_ARRAY)
 #define UNITY_TEST_ASSERT_EQUAL_HEX64_ARRAY(expected, actual, num_elements, line, message)       UnityAssertEqualIntArray((UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_HEX64,  UNITY_ARRAY_TO_ARRAY)
@@ -2,16 +2,85 @@
 バッチ処理モジュール
 
 複数のC言語ファイルをバッチ処理する機能を提供します。
+incremental指定時は、対象関数とその依存（同一ファイル内の推移的な
+呼び出し先・ローカルインクルード）の内容ハッシュを永続化し、
+変化のないアイテムの再生成をスキップしてキャッシュ結果を返します。
+use_processes指定時はプロセスプールで並列化し、CPUバウンドな
+生成処理でもGILの影響を受けずに全コアを使えます。
 """
 
+import hashlib
 import json
+import os
+import pickle
+import re
 from pathlib import Path
 from typing import List, Dict, Any, Optional, Tuple
 from dataclasses import dataclass, asdict
-from concurrent.futures import ThreadPoolExecutor, as_completed
+from concurrent.futures import ThreadPoolExecutor, ProcessPoolExecutor, as_completed
 import time
 
 from .error_handler import ErrorHandler, GeneratorError, ErrorCode, ErrorContext
+from .test_generator.build_manifest_generator import BuildManifestGenerator
+
+
+def _run_generation(generator, item: 'BatchItem') -> 'BatchResult':
+    """
+    単一アイテムの生成処理を実行する
+
+    プロセスプールのワーカーから呼べるようモジュールレベルに置く
+    （メソッドだとBatchProcessor全体のpickleが必要になる）。
+
+    Args:
+        generator: CTestAutoGeneratorのインスタンス
+        item: バッチアイテム
+
+    Returns:
+        処理結果
+    """
+    start_time = time.time()
+
+    try:
+        # 出力ディレクトリの設定
+        output_dir = item.output_dir or "output"
+
+        # 生成処理を実行
+        result = generator.generate_all(
+            c_file_path=item.input_file,
+            target_function=item.function_name,
+            output_dir=output_dir,
+            truth_table_file=item.truth_table_file,
+            test_code_file=item.test_code_file,
+            io_table_file=item.io_table_file
+        )
+
+        execution_time = time.time() - start_time
+
+        # 生成されたファイルのリストを作成
+        generated_files = []
+        if result.truth_table_path:
+            generated_files.append(str(result.truth_table_path))
+        if result.test_code_path:
+            generated_files.append(str(result.test_code_path))
+        if result.io_table_path:
+            generated_files.append(str(result.io_table_path))
+
+        return BatchResult(
+            item=item,
+            success=True,
+            execution_time=execution_time,
+            generated_files=generated_files
+        )
+
+    except Exception as e:
+        execution_time = time.time() - start_time
+
+        return BatchResult(
+            item=item,
+            success=False,
+            execution_time=execution_time,
+            error_message=str(e)
+        )
 
 
 @dataclass
@@ -42,7 +111,8 @@ class BatchResult:
     execution_time: float
     error_message: Optional[str] = None
     generated_files: Optional[List[str]] = None
-    
+    cached: bool = False  # インクリメンタルモードでキャッシュから返した結果か
+
     def to_dict(self) -> Dict[str, Any]:
         """辞書に変換"""
         result = {
@@ -55,9 +125,207 @@ class BatchResult:
             result['error_message'] = self.error_message
         if self.generated_files:
             result['generated_files'] = self.generated_files
+        if self.cached:
+            result['cached'] = True
         return result
 
 
+class IncrementalCache:
+    """
+    インクリメンタル再生成用のハッシュキャッシュ
+
+    対象関数の本体・同一ファイル内の推移的な呼び出し先関数・
+    ローカルインクルードヘッダの内容ハッシュを永続化し、
+    いずれも変化していないアイテムの再生成をスキップする。
+    """
+
+    def __init__(self, cache_file: str = ".autounitest_batch_cache.json"):
+        """
+        初期化
+
+        Args:
+            cache_file: キャッシュファイルのパス（JSON形式）
+        """
+        self.cache_file = cache_file
+        self._entries: Dict[str, Dict[str, Any]] = {}
+        self._load()
+
+    def _load(self) -> None:
+        """キャッシュファイルを読み込む（壊れていれば空から開始）"""
+        try:
+            with open(self.cache_file, 'r', encoding='utf-8') as f:
+                data = json.load(f)
+            if isinstance(data, dict):
+                self._entries = data
+        except (FileNotFoundError, json.JSONDecodeError, OSError):
+            self._entries = {}
+
+    def save(self) -> None:
+        """キャッシュファイルを書き出す"""
+        with open(self.cache_file, 'w', encoding='utf-8') as f:
+            json.dump(self._entries, f, ensure_ascii=False, indent=2)
+
+    @staticmethod
+    def _key(item: BatchItem) -> str:
+        """アイテムのキャッシュキー"""
+        return f"{item.input_file}::{item.function_name}"
+
+    def compute_hash(self, item: BatchItem) -> Optional[str]:
+        """
+        アイテムの依存内容ハッシュを計算する
+
+        対象: 対象関数の本体、同一ファイル内で推移的に呼び出される
+        関数の本体、ローカルインクルード（#include "..."）の内容。
+        ソースが読めない場合や対象関数が見つからない場合は None
+        （＝常に再生成）。
+
+        Args:
+            item: バッチアイテム
+
+        Returns:
+            SHA-256ハッシュの16進文字列、計算できない場合はNone
+        """
+        try:
+            source = Path(item.input_file).read_text(encoding='utf-8', errors='replace')
+        except OSError:
+            return None
+
+        functions = self._extract_function_bodies(source)
+        if item.function_name not in functions:
+            return None
+
+        # 対象関数から同一ファイル内の呼び出し先を推移的に収集
+        visited: List[str] = []
+        pending = [item.function_name]
+        while pending:
+            name = pending.pop()
+            if name in visited:
+                continue
+            visited.append(name)
+            body = functions.get(name, '')
+            for callee in re.findall(r'\b([A-Za-z_]\w*)\s*\(', body):
+                if callee in functions and callee not in visited:
+                    pending.append(callee)
+
+        hasher = hashlib.sha256()
+        for name in sorted(visited):
+            hasher.update(name.encode('utf-8'))
+            hasher.update(functions[name].encode('utf-8'))
+
+        # ローカルインクルードヘッダの内容もハッシュに含める
+        source_dir = Path(item.input_file).parent
+        for header in sorted(set(re.findall(r'#include\s*"([^"]+)"', source))):
+            hasher.update(header.encode('utf-8'))
+            header_path = source_dir / header
+            try:
+                hasher.update(header_path.read_bytes())
+            except OSError:
+                pass  # 見つからないヘッダは名前のみ（存在の変化は検出される）
+
+        return hasher.hexdigest()
+
+    @staticmethod
+    def _extract_function_bodies(source: str) -> Dict[str, str]:
+        """
+        ソース中の関数定義を名前→本体のマップとして抽出する
+
+        Args:
+            source: Cソースコード
+
+        Returns:
+            関数名→定義テキスト（シグネチャ含む）のマップ
+        """
+        functions: Dict[str, str] = {}
+        # 関数定義の開始: 型 名前(引数) { （プロトタイプや制御文は除外）
+        pattern = re.compile(
+            r'^[A-Za-z_][\w\s\*]*?\b([A-Za-z_]\w*)\s*\([^;{)]*\)\s*\{', re.MULTILINE)
+
+        for match in pattern.finditer(source):
+            name = match.group(1)
+            if name in ('if', 'for', 'while', 'switch', 'return', 'sizeof'):
+                continue
+            # 開き括弧から対応する閉じ括弧まで本体を切り出す
+            depth = 0
+            end = None
+            for pos in range(match.end() - 1, len(source)):
+                if source[pos] == '{':
+                    depth += 1
+                elif source[pos] == '}':
+                    depth -= 1
+                    if depth == 0:
+                        end = pos + 1
+                        break
+            if end is not None:
+                functions[name] = source[match.start():end]
+
+        return functions
+
+    def is_fresh(self, item: BatchItem, current_hash: Optional[str]) -> bool:
+        """
+        アイテムが再生成不要（キャッシュが新鮮）か判定する
+
+        前回成功時とハッシュが一致し、生成物が全て存在する場合のみTrue。
+
+        Args:
+            item: バッチアイテム
+            current_hash: compute_hash()の結果
+
+        Returns:
+            再生成をスキップできる場合True
+        """
+        if current_hash is None:
+            return False
+
+        entry = self._entries.get(self._key(item))
+        if not entry or not entry.get('success'):
+            return False
+        if entry.get('hash') != current_hash:
+            return False
+
+        # 生成物が消えていたら再生成
+        for path in entry.get('generated_files') or []:
+            if not Path(path).exists():
+                return False
+
+        return True
+
+    def cached_result(self, item: BatchItem) -> BatchResult:
+        """
+        キャッシュ済みアイテムの結果を合成する
+
+        Args:
+            item: バッチアイテム
+
+        Returns:
+            cached=TrueのBatchResult
+        """
+        entry = self._entries.get(self._key(item), {})
+        return BatchResult(
+            item=item,
+            success=True,
+            execution_time=0.0,
+            generated_files=entry.get('generated_files'),
+            cached=True
+        )
+
+    def update(self, item: BatchItem, item_hash: Optional[str], result: BatchResult) -> None:
+        """
+        処理結果をキャッシュに反映する
+
+        Args:
+            item: バッチアイテム
+            item_hash: compute_hash()の結果
+            result: 処理結果
+        """
+        if item_hash is None:
+            return
+        self._entries[self._key(item)] = {
+            'hash': item_hash,
+            'success': result.success,
+            'generated_files': result.generated_files or [],
+        }
+
+
 class BatchProcessor:
     """バッチ処理クラス"""
     
@@ -66,56 +334,120 @@ class BatchProcessor:
         generator,
         error_handler: Optional[ErrorHandler] = None,
         max_workers: int = 4,
-        continue_on_error: bool = True
+        continue_on_error: bool = True,
+        incremental: bool = False,
+        cache_file: str = ".autounitest_batch_cache.json",
+        build_manifest: bool = True
     ):
         """
         初期化
-        
+
         Args:
             generator: CTestAutoGeneratorのインスタンス
             error_handler: エラーハンドラー
             max_workers: 並列処理の最大ワーカー数
             continue_on_error: エラー発生時も処理を継続するか
+            incremental: 依存内容ハッシュが変化したアイテムのみ再生成するか
+            cache_file: インクリメンタルモードのキャッシュファイルパス
+            build_manifest: 出力ディレクトリごとに生成ソースと整合する
+                Makefileを書き出すか（v5.5.0）
         """
         self.generator = generator
         self.error_handler = error_handler or ErrorHandler()
         self.max_workers = max_workers
         self.continue_on_error = continue_on_error
+        self.incremental = incremental
+        self.cache = IncrementalCache(cache_file) if incremental else None
+        self.build_manifest = build_manifest
         self.results: List[BatchResult] = []
     
     def process_batch(
         self,
         items: List[BatchItem],
-        parallel: bool = False
+        parallel: bool = False,
+        use_processes: bool = False
     ) -> List[BatchResult]:
         """
         バッチ処理を実行
-        
+
         Args:
             items: 処理するアイテムのリスト
             parallel: 並列処理を有効にするか
-        
+            use_processes: 並列処理にプロセスプールを使うか
+                （CPUバウンドな生成処理でGILの影響を受けない。
+                ジェネレータがpickle不可の場合はスレッドにフォールバック）
+
         Returns:
             処理結果のリスト
         """
         self.results = []
         total = len(items)
-        
+
         self.error_handler.info(f"バッチ処理開始: {total}個のアイテム")
         self.error_handler.info(f"並列処理: {'有効' if parallel else '無効'}")
-        
+        if parallel and use_processes:
+            self.error_handler.info("並列方式: プロセスプール")
+
         start_time = time.time()
-        
-        if parallel and total > 1:
-            self.results = self._process_parallel(items)
+
+        # インクリメンタルモード: ハッシュが変化したアイテムだけを処理対象にする
+        item_hashes: Dict[int, Optional[str]] = {}
+        cached_results: Dict[int, BatchResult] = {}
+        stale_items: List[BatchItem] = []
+        if self.incremental:
+            for i, item in enumerate(items):
+                item_hash = self.cache.compute_hash(item)
+                item_hashes[i] = item_hash
+                if self.cache.is_fresh(item, item_hash):
+                    cached_results[i] = self.cache.cached_result(item)
+                else:
+                    stale_items.append(item)
+            self.error_handler.info(
+                f"インクリメンタル: {len(cached_results)}個をキャッシュから返却、"
+                f"{len(stale_items)}個を再生成")
         else:
-            self.results = self._process_sequential(items)
-        
+            stale_items = list(items)
+
+        if parallel and len(stale_items) > 1:
+            if use_processes:
+                processed = self._process_parallel_processes(stale_items)
+            else:
+                processed = self._process_parallel(stale_items)
+        else:
+            processed = self._process_sequential(stale_items)
+
+        # 元の順序でキャッシュ結果と処理結果を統合
+        # （処理結果はstale_itemsの順に並んでいる。プロセスプール経由では
+        # itemがコピーされるため、同一性ではなく値で突き合わせる）
+        if self.incremental:
+            pending = list(processed)
+            merged: List[BatchResult] = []
+            for i, item in enumerate(items):
+                if i in cached_results:
+                    merged.append(cached_results[i])
+                elif pending and pending[0].item == item:
+                    result = pending.pop(0)
+                    self.cache.update(item, item_hashes[i], result)
+                    merged.append(result)
+            self.results = merged
+            self.cache.save()
+        else:
+            self.results = processed
+
+        # v5.5.0: 生成ソースと整合するビルドマニフェストを書き出す
+        if self.build_manifest:
+            self._write_build_manifests()
+
+        # v5.6.0: スイートモードでは結合ランナーも書き出す
+        if getattr(getattr(self.generator, 'test_generator', None),
+                   'suite_mode', False):
+            self._write_combined_runners()
+
         elapsed_time = time.time() - start_time
-        
+
         # サマリーを出力
         self._print_summary(elapsed_time)
-        
+
         return self.results
     
     def _process_sequential(self, items: List[BatchItem]) -> List[BatchResult]:
@@ -165,54 +497,122 @@ class BatchProcessor:
         results.sort(key=lambda r: items.index(r.item))
         return results
     
-    def _process_single_item(self, item: BatchItem) -> BatchResult:
-        """単一アイテムの処理"""
-        start_time = time.time()
-        
+    def _process_parallel_processes(self, items: List[BatchItem]) -> List[BatchResult]:
+        """
+        プロセスプールによる並列処理
+
+        生成処理はCPUバウンドのため、プロセスプールならGILの影響を受けずに
+        全コアを使える。ジェネレータがpickleできない場合は
+        スレッドプールにフォールバックする。
+        """
+        # ワーカーにはジェネレータごと渡すため、pickleできることを事前に確認する
+        # （ワーカー側で失敗すると個別エラーになり、フォールバックできない）
         try:
-            # 出力ディレクトリの設定
-            output_dir = item.output_dir or "output"
-            
-            # 生成処理を実行
-            result = self.generator.generate_all(
-                c_file_path=item.input_file,
-                target_function=item.function_name,
-                output_dir=output_dir,
-                truth_table_file=item.truth_table_file,
-                test_code_file=item.test_code_file,
-                io_table_file=item.io_table_file
-            )
-            
-            execution_time = time.time() - start_time
-            
-            # 生成されたファイルのリストを作成
-            generated_files = []
-            if result.truth_table_path:
-                generated_files.append(str(result.truth_table_path))
-            if result.test_code_path:
-                generated_files.append(str(result.test_code_path))
-            if result.io_table_path:
-                generated_files.append(str(result.io_table_path))
-            
-            return BatchResult(
-                item=item,
-                success=True,
-                execution_time=execution_time,
-                generated_files=generated_files
-            )
-        
+            pickle.dumps(self.generator)
         except Exception as e:
-            execution_time = time.time() - start_time
-            error_msg = str(e)
-            self.error_handler.error(f"処理失敗: {item.input_file} - {error_msg}")
-            
-            return BatchResult(
-                item=item,
-                success=False,
-                execution_time=execution_time,
-                error_message=error_msg
-            )
+            self.error_handler.warning(
+                f"プロセスプールを使用できないためスレッドプールで実行します: {str(e)}")
+            return self._process_parallel(items)
+
+        results = []
+
+        with ProcessPoolExecutor(max_workers=self.max_workers) as executor:
+            future_to_item = {
+                executor.submit(_run_generation, self.generator, item): (i, item)
+                for i, item in enumerate(items, 1)
+            }
+
+            for future in as_completed(future_to_item):
+                i, item = future_to_item[future]
+                self.error_handler.info(f"完了 ({i}/{len(items)}): {item.input_file} - {item.function_name}")
+
+                try:
+                    result = future.result()
+                    if not result.success and result.error_message:
+                        self.error_handler.error(
+                            f"処理失敗: {item.input_file} - {result.error_message}")
+                    results.append(result)
+                except Exception as e:
+                    self.error_handler.error(f"並列処理中にエラーが発生: {str(e)}")
+                    results.append(BatchResult(
+                        item=item,
+                        success=False,
+                        execution_time=0,
+                        error_message=str(e)
+                    ))
+
+        # 元の順序でソート
+        results.sort(key=lambda r: items.index(r.item))
+        return results
+
+    def _process_single_item(self, item: BatchItem) -> BatchResult:
+        """単一アイテムの処理"""
+        result = _run_generation(self.generator, item)
+
+        if not result.success and result.error_message:
+            self.error_handler.error(f"処理失敗: {item.input_file} - {result.error_message}")
+
+        return result
     
+    def _write_build_manifests(self):
+        """
+        出力ディレクトリごとにビルドマニフェスト（Makefile）を書き出す (v5.5.0)
+
+        成功した結果（キャッシュ再利用分も含む）の生成テストソースを
+        ディレクトリ単位で集め、今回の成果物と常に整合するMakefileを
+        再生成する。unity.cへのパスは出力ディレクトリからの相対で解決する。
+        """
+        unity_dir = os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                                 '..', 'output')
+
+        by_dir: Dict[str, List[str]] = {}
+        for result in self.results:
+            if not result.success or not result.generated_files:
+                continue
+            for file_path in result.generated_files:
+                if file_path.endswith('.c'):
+                    parent = str(Path(file_path).parent)
+                    by_dir.setdefault(parent, []).append(Path(file_path).name)
+
+        for output_dir, sources in by_dir.items():
+            try:
+                manifest_gen = BuildManifestGenerator(
+                    unity_dir=os.path.relpath(unity_dir, output_dir))
+                path = manifest_gen.write_makefile(output_dir, sorted(set(sources)))
+                self.error_handler.info(f"ビルドマニフェストを書き出し: {path}")
+            except OSError as e:
+                # マニフェストが書けなくても生成結果自体は有効
+                self.error_handler.warning(f"ビルドマニフェストの書き込みに失敗: {e}")
+
+    def _write_combined_runners(self):
+        """
+        出力ディレクトリごとに結合テストランナーを書き出す (v5.6.0)
+
+        suite_modeで生成されたハーネスはmain()を持たないため、
+        同じディレクトリのスイートを順に呼ぶランナーがないとリンクできない。
+        成功した結果の関数名を処理順に集めてtest_suite_runner.cを再生成する。
+        """
+        by_dir: Dict[str, List[str]] = {}
+        for result in self.results:
+            if not result.success or not result.generated_files:
+                continue
+            for file_path in result.generated_files:
+                if file_path.endswith('.c'):
+                    parent = str(Path(file_path).parent)
+                    by_dir.setdefault(parent, []).append(result.item.function_name)
+
+        for output_dir, function_names in by_dir.items():
+            try:
+                runner_code = self.generator.test_generator.generate_combined_runner(
+                    function_names)
+                path = os.path.join(output_dir, "test_suite_runner.c")
+                with open(path, 'w', encoding='shift_jis') as f:
+                    f.write(runner_code)
+                self.error_handler.info(
+                    f"結合ランナーを書き出し: {path} ({len(function_names)}スイート)")
+            except OSError as e:
+                self.error_handler.warning(f"結合ランナーの書き込みに失敗: {e}")
+
     def _print_summary(self, total_time: float):
         """処理サマリーを出力"""
         success_count = sum(1 for r in self.results if r.success)
@@ -224,6 +624,9 @@ class BatchProcessor:
         print(f"合計処理数: {len(self.results)}")
         print(f"成功: {success_count}")
         print(f"失敗: {fail_count}")
+        cached_count = sum(1 for r in self.results if r.cached)
+        if cached_count > 0:
+            print(f"キャッシュ返却（再生成スキップ）: {cached_count}")
         print(f"総実行時間: {total_time:.2f}秒")
         
         if self.results:
@@ -352,16 +755,18 @@ class BatchProcessor:
         directory: str,
         pattern: str = "*.c",
         output_base_dir: str = "output",
-        parallel: bool = False
+        parallel: bool = False,
+        use_processes: bool = False
     ) -> List[BatchResult]:
         """
         ディレクトリ内のすべてのファイルをバッチ処理
-        
+
         Args:
             directory: 処理するディレクトリ
             pattern: ファイルパターン（glob形式）
             output_base_dir: 出力ベースディレクトリ
             parallel: 並列処理を有効にするか
+            use_processes: 並列処理にプロセスプールを使うか
         
         Returns:
             処理結果のリスト
@@ -405,7 +810,7 @@ class BatchProcessor:
         self.error_handler.info(f"処理対象: {len(items)}個の関数")
         
         # バッチ処理を実行
-        return self.process_batch(items, parallel=parallel)
+        return self.process_batch(items, parallel=parallel, use_processes=use_processes)
     
     def _detect_first_function(self, file_path: Path) -> Optional[str]:
         """
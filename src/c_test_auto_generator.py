@@ -12,6 +12,7 @@ from typing import Optional, Dict, Any, Tuple
 from dataclasses import dataclass
 
 from .parser.c_code_parser import CCodeParser
+from .parser.parse_cache import ParseCache
 from .truth_table.truth_table_generator import TruthTableGenerator
 from .test_generator.unity_test_generator import UnityTestGenerator
 from .io_table.io_table_generator import IOTableGenerator
@@ -156,18 +157,43 @@ class CTestAutoGenerator:
         
         # v2.2: テスト対象関数本体をテストコードに含めるかの設定
         include_target_function = self.config.get('include_target_function', True)
+
+        # v5.3.0: 同一条件のテストケースをテーブル駆動に集約するかの設定
+        table_driven = self.config.get('table_driven', False)
+
+        # v5.4.0: 大きな文字列フィクスチャをバイナリサイドカーに移す閾値（Noneで無効）
+        fixture_blob_threshold = self.config.get('fixture_blob_threshold')
+
+        # v5.6.0: main()の代わりにスイートエントリを生成するかの設定
+        suite_mode = self.config.get('suite_mode', False)
+
+        # v5.7.0: 対象関数のif条件に分岐カバレッジカウンタを埋め込むかの設定
+        branch_coverage = self.config.get('branch_coverage', False)
         
         # v4.8.2: パーサー初期化時にinclude_pathsを渡す（ファイル解析時に更新）
         self._base_include_paths = include_paths.copy() if include_paths else []
         self._enable_includes = enable_includes
         
+        # v5.8.0: 前処理結果の永続キャッシュ（バッチ処理ではCLIが既定で有効化）
+        parse_cache = None
+        if self.config.get('parse_cache', False):
+            cache_dir = self.config.get('parse_cache_dir', '.autounitest_parse_cache')
+            parse_cache = ParseCache(cache_dir=cache_dir)
+
         self.parser = CCodeParser(
             defines=defines,
             include_paths=include_paths,
-            enable_includes=enable_includes
+            enable_includes=enable_includes,
+            parse_cache=parse_cache
         )
         self.truth_table_generator = TruthTableGenerator()
-        self.test_generator = UnityTestGenerator(include_target_function=include_target_function)
+        self.test_generator = UnityTestGenerator(
+            include_target_function=include_target_function,
+            table_driven=table_driven,
+            fixture_blob_threshold=fixture_blob_threshold,
+            suite_mode=suite_mode,
+            branch_coverage=branch_coverage
+        )
         self.io_table_generator = IOTableGenerator()
         self.excel_writer = ExcelWriter()
     
@@ -294,6 +320,12 @@ class CTestAutoGenerator:
                 else:
                     raise Exception("テストコードの書き込みに失敗しました")
             
+            # v5.4.0: サイドカー参照コードを出力した場合は、同じ場所に
+            # フィクスチャバイナリも書き出す（mmap先が無いと実行できない）
+            blob_path = self.test_generator.write_fixture_blob(str(output_path), parsed_data)
+            if blob_path:
+                print(f"   ✓ フィクスチャサイドカー生成完了: {blob_path}")
+
             # 4. I/O表を生成
             print(f"📝 Step 4/4: I/O一覧表を生成中...")
             io_table = self.io_table_generator.generate(test_code, truth_table)
@@ -389,6 +421,12 @@ class CTestAutoGenerator:
                 print(f"✅ テストコードの生成が完了しました: {output_path}（Shift-JIS）")
             else:
                 raise Exception("テストコードの書き込みに失敗しました")
+
+            # v5.4.0: フィクスチャサイドカーをテストコードと同じ場所に書き出す
+            blob_path = self.test_generator.write_fixture_blob(
+                str(Path(output_path).parent), parsed_data)
+            if blob_path:
+                print(f"✅ フィクスチャサイドカーを生成しました: {blob_path}")
             
         except Exception as e:
             result.success = False
@@ -286,6 +286,25 @@ def create_parser() -> argparse.ArgumentParser:
         action='store_true',
         help='エラーが発生しても処理を継続'
     )
+
+    # v5.8.0: インクリメンタル再生成・プロセスプールオプション
+    batch_group.add_argument(
+        '--incremental',
+        action='store_true',
+        help='依存内容（関数本体・呼び出し先・ヘッダ）が変化したアイテムのみ再生成'
+    )
+
+    batch_group.add_argument(
+        '--use-processes',
+        action='store_true',
+        help='並列バッチ処理にプロセスプールを使用（--parallelと併用）'
+    )
+
+    batch_group.add_argument(
+        '--no-parse-cache',
+        action='store_true',
+        help='前処理結果の永続キャッシュを無効化（バッチ処理では既定で有効）'
+    )
     
     batch_group.add_argument(
         '--save-results',
@@ -377,6 +396,35 @@ def create_parser() -> argparse.ArgumentParser:
         action='store_false',
         help='テスト対象関数の本体をテストコードに含めない'
     )
+
+    # v5.3.0: テーブル駆動テスト統合オプション
+    codegen_group.add_argument(
+        '--table-driven',
+        action='store_true',
+        help='同一条件のテストケースをテーブル駆動テストに集約する'
+    )
+
+    # v5.4.0: フィクスチャサイドカーオプション
+    codegen_group.add_argument(
+        '--fixture-blob-threshold',
+        type=int,
+        metavar='BYTES',
+        help='このバイト数以上の文字列フィクスチャをバイナリサイドカーに移す'
+    )
+
+    # v5.6.0: マルチスイート単一バイナリオプション
+    codegen_group.add_argument(
+        '--suite-mode',
+        action='store_true',
+        help='main()の代わりにスイートエントリを生成し、バッチ処理時は結合ランナーも書き出す'
+    )
+
+    # v5.7.0: 分岐カバレッジオプション
+    codegen_group.add_argument(
+        '--branch-coverage',
+        action='store_true',
+        help='対象関数のif条件にヒットカウンタを埋め込み、実行終了時にカバレッジを出力する'
+    )
     
     # その他
     parser.add_argument(
@@ -588,6 +636,27 @@ def main():
         else:
             error_handler.info("v2.2: テスト対象関数の本体をテストコードに含めません")
     
+    # v5.3.0: --table-drivenオプション
+    if hasattr(args, 'table_driven') and args.table_driven:
+        config_dict['table_driven'] = True
+        error_handler.info("v5.3.0: テーブル駆動テスト統合を有効化")
+
+    # v5.4.0: --fixture-blob-thresholdオプション
+    if getattr(args, 'fixture_blob_threshold', None) is not None:
+        config_dict['fixture_blob_threshold'] = args.fixture_blob_threshold
+        error_handler.info(
+            f"v5.4.0: {args.fixture_blob_threshold}バイト以上のフィクスチャをサイドカーに移します")
+
+    # v5.6.0: --suite-modeオプション
+    if hasattr(args, 'suite_mode') and args.suite_mode:
+        config_dict['suite_mode'] = True
+        error_handler.info("v5.6.0: マルチスイートモードを有効化")
+
+    # v5.7.0: --branch-coverageオプション
+    if hasattr(args, 'branch_coverage') and args.branch_coverage:
+        config_dict['branch_coverage'] = True
+        error_handler.info("v5.7.0: 分岐カバレッジカウンタを有効化")
+
     # v2.4.3: --no-standaloneオプション
     if hasattr(args, 'no_standalone') and args.no_standalone:
         config_dict['standalone_mode'] = False
@@ -596,6 +665,12 @@ def main():
         config_dict['standalone_mode'] = True
         error_handler.info("v2.4.3: スタンドアロンモード（元のソースファイルにテストコードを追加）")
     
+    # v5.8.0: バッチ処理では前処理キャッシュを既定で有効化
+    # （同じベンダーヘッダ群を翻訳単位ごとに展開し直さない）
+    if (args.batch or args.batch_dir) and not args.no_parse_cache:
+        config_dict.setdefault('parse_cache', True)
+        error_handler.info("v5.8.0: 前処理結果の永続キャッシュを有効化")
+
     # 生成器初期化
     generator = CTestAutoGenerator(config=config_dict)
     
@@ -616,20 +691,26 @@ def main():
                 generator=generator,
                 error_handler=error_handler,
                 max_workers=args.workers,
-                continue_on_error=args.continue_on_error
+                continue_on_error=args.continue_on_error,
+                incremental=args.incremental
             )
-            
+
             if args.batch:
                 # バッチ設定ファイルから処理
                 items = batch_processor.load_batch_config(args.batch)
-                results = batch_processor.process_batch(items, parallel=args.parallel)
+                results = batch_processor.process_batch(
+                    items,
+                    parallel=args.parallel,
+                    use_processes=args.use_processes
+                )
             else:
                 # ディレクトリを一括処理
                 results = batch_processor.process_directory(
                     directory=args.batch_dir,
                     pattern=args.pattern,
                     output_base_dir=args.output,
-                    parallel=args.parallel
+                    parallel=args.parallel,
+                    use_processes=args.use_processes
                 )
             
             # 結果を保存
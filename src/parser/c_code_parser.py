@@ -23,20 +23,23 @@ from src.parser.variable_decl_extractor import VariableDeclExtractor  # v2.2: 
 class CCodeParser:
     """C言語コードパーサー"""
     
-    def __init__(self, defines: Dict[str, str] = None, include_paths: list = None, enable_includes: bool = False):
+    def __init__(self, defines: Dict[str, str] = None, include_paths: list = None, enable_includes: bool = False,
+                 parse_cache=None):
         """
         初期化
-        
+
         Args:
             defines: 事前定義するマクロ辞書 {マクロ名: 値}
             include_paths: インクルードパスのリスト
             enable_includes: ヘッダーファイルの読み込みを有効化するか
+            parse_cache: 前処理結果の永続キャッシュ（v5.8.0、ParseCacheまたはNone）
         """
         self.logger = setup_logger(__name__)
         self.preprocessor = Preprocessor(
             defines=defines,
             include_paths=include_paths,
-            enable_includes=enable_includes
+            enable_includes=enable_includes,
+            cache=parse_cache
         )
         self.ast_builder = ASTBuilder()
         self.typedef_extractor = TypedefExtractor()  # v2.2: 追加
@@ -0,0 +1,173 @@
+"""
+ParseCacheモジュール
+
+前処理結果の永続キャッシュ (v5.8.0)
+
+同じベンダーヘッダ群が翻訳単位ごとに何度も前処理されるのを避けるため、
+前処理済みコードと前処理で得られた状態（マクロ定義・関数マクロ・
+ビットフィールド情報）をディスクに保存する。キーは入力コードと
+マクロ環境（事前定義・インクルードパス設定）のハッシュで、
+エントリには展開したヘッダファイルの内容ハッシュを記録し、
+ヘッダが変化していない限りラン内でもラン間でも再利用できる。
+"""
+
+import hashlib
+import json
+import os
+import sys
+from typing import Any, Dict, Optional
+
+# パスを追加
+sys.path.insert(0, os.path.join(os.path.dirname(__file__), '../..'))
+from src.utils import setup_logger
+
+
+class ParseCache:
+    """前処理結果の永続キャッシュ"""
+
+    def __init__(self, cache_dir: str = ".autounitest_parse_cache"):
+        """
+        初期化
+
+        Args:
+            cache_dir: キャッシュディレクトリ（エントリごとに1つのJSONファイル）
+        """
+        self.logger = setup_logger(__name__)
+        self.cache_dir = cache_dir
+        # ラン内はメモリ上のエントリを優先（ディスクI/Oも1回に抑える）
+        self._memory: Dict[str, Dict[str, Any]] = {}
+        self.hits = 0
+        self.misses = 0
+
+    def make_key(self, code: str, environment: Dict[str, Any]) -> str:
+        """
+        キャッシュキーを計算する
+
+        Args:
+            code: 前処理前のソースコード
+            environment: マクロ環境（事前定義・インクルードパスなど）
+
+        Returns:
+            SHA-256ハッシュの16進文字列
+        """
+        hasher = hashlib.sha256()
+        hasher.update(code.encode('utf-8'))
+        hasher.update(json.dumps(environment, sort_keys=True,
+                                 ensure_ascii=False).encode('utf-8'))
+        return hasher.hexdigest()
+
+    def get(self, key: str) -> Optional[Dict[str, Any]]:
+        """
+        キャッシュエントリを取得する
+
+        エントリに記録された依存ヘッダの内容ハッシュを検証し、
+        1つでも変化していれば無効としてNoneを返す。
+
+        Args:
+            key: make_key()で計算したキー
+
+        Returns:
+            エントリの辞書、ミスまたは無効の場合はNone
+        """
+        entry = self._memory.get(key)
+        if entry is None:
+            entry = self._load_from_disk(key)
+
+        if entry is None:
+            self.misses += 1
+            return None
+
+        # 依存ヘッダの検証
+        for path, file_hash in (entry.get('deps') or {}).items():
+            if self._hash_file(path) != file_hash:
+                self.logger.debug(f"キャッシュ無効（ヘッダ変更）: {path}")
+                self._memory.pop(key, None)
+                self.misses += 1
+                return None
+
+        self._memory[key] = entry
+        self.hits += 1
+        return entry
+
+    def put(self, key: str, payload: Dict[str, Any],
+            dep_files: Optional[Dict[str, str]] = None) -> None:
+        """
+        キャッシュエントリを保存する
+
+        Args:
+            key: make_key()で計算したキー
+            payload: 保存する内容（前処理済みコードと前処理状態）
+            dep_files: 依存ヘッダ {ヘッダ名: 解決済みパス}
+        """
+        deps = {}
+        for path in (dep_files or {}).values():
+            file_hash = self._hash_file(path)
+            if file_hash is not None:
+                deps[path] = file_hash
+
+        entry = dict(payload)
+        entry['deps'] = deps
+        self._memory[key] = entry
+
+        try:
+            os.makedirs(self.cache_dir, exist_ok=True)
+            with open(self._entry_path(key), 'w', encoding='utf-8') as f:
+                json.dump(entry, f, ensure_ascii=False)
+        except OSError as e:
+            # キャッシュ書き込み失敗は致命的ではない（次回もミスになるだけ）
+            self.logger.warning(f"キャッシュの書き込みに失敗: {e}")
+
+    def _entry_path(self, key: str) -> str:
+        """エントリのファイルパス"""
+        return os.path.join(self.cache_dir, f"{key}.json")
+
+    def _load_from_disk(self, key: str) -> Optional[Dict[str, Any]]:
+        """ディスクからエントリを読み込む（壊れていればNone）"""
+        try:
+            with open(self._entry_path(key), 'r', encoding='utf-8') as f:
+                return json.load(f)
+        except (FileNotFoundError, json.JSONDecodeError, OSError):
+            return None
+
+    @staticmethod
+    def _hash_file(path: str) -> Optional[str]:
+        """ファイル内容のSHA-256を計算する（読めない場合はNone）"""
+        try:
+            with open(path, 'rb') as f:
+                return hashlib.sha256(f.read()).hexdigest()
+        except OSError:
+            return None
+
+
+if __name__ == "__main__":
+    # ParseCacheのテスト
+    import tempfile
+
+    print("=" * 70)
+    print("ParseCache のテスト")
+    print("=" * 70)
+    print()
+
+    with tempfile.TemporaryDirectory() as tmp:
+        cache = ParseCache(cache_dir=os.path.join(tmp, "cache"))
+
+        header = os.path.join(tmp, "dep.h")
+        with open(header, 'w') as f:
+            f.write("#define DEP 1\n")
+
+        key = cache.make_key("int x;", {'defines': {}, 'enable_includes': True})
+        print(f"1. ミス: {cache.get(key)}")
+
+        cache.put(key, {'code': 'int x;'}, {'dep.h': header})
+        print(f"2. ヒット: {cache.get(key) is not None}")
+
+        # 別インスタンス（ラン間の永続化）
+        cache2 = ParseCache(cache_dir=os.path.join(tmp, "cache"))
+        print(f"3. ディスクからヒット: {cache2.get(key) is not None}")
+
+        # ヘッダ変更で無効化
+        with open(header, 'w') as f:
+            f.write("#define DEP 2\n")
+        print(f"4. ヘッダ変更後は無効: {cache2.get(key)}")
+
+        print(f"5. 統計: hits={cache.hits}, misses={cache.misses}")
@@ -10,7 +10,7 @@ C言語ソースコードの前処理を行う
 import re
 import sys
 import os
-from typing import Dict, List, Tuple
+from typing import Any, Dict, List, Tuple
 
 # パスを追加
 sys.path.insert(0, os.path.join(os.path.dirname(__file__), '../..'))
@@ -20,14 +20,16 @@ from src.utils import setup_logger
 class Preprocessor:
     """C言語プリプロセッサ"""
     
-    def __init__(self, defines: Dict[str, str] = None, include_paths: List[str] = None, enable_includes: bool = False):
+    def __init__(self, defines: Dict[str, str] = None, include_paths: List[str] = None, enable_includes: bool = False,
+                 cache=None):
         """
         初期化
-        
+
         Args:
             defines: 事前定義するマクロ辞書 {マクロ名: 値}
             include_paths: インクルードパスのリスト
             enable_includes: ヘッダーファイルの読み込みを有効化するか
+            cache: 前処理結果の永続キャッシュ（v5.8.0、ParseCacheまたはNone）
         """
         self.logger = setup_logger(__name__)
         self.defines: Dict[str, str] = defines.copy() if defines else {}
@@ -37,8 +39,12 @@ class Preprocessor:
         self.function_macros: Dict[str, Tuple[List[str], str]] = {}
         # インクルード済みファイルを追跡（循環インクルード防止）
         self.included_files: set = set()
+        # v5.8.0: インクルード済みファイルの解決済みパス {ヘッダ名: パス}
+        self.included_file_paths: Dict[str, str] = {}
         # ビットフィールド情報を保持 {メンバー名: (構造体名, ビット幅, 基本型)}
         self.bitfields: Dict[str, Tuple[str, int, str]] = {}
+        # v5.8.0: 前処理結果の永続キャッシュ
+        self.cache = cache
     
     def preprocess(self, code: str) -> str:
         """
@@ -51,10 +57,25 @@ class Preprocessor:
             前処理済みコード
         """
         self.logger.info("前処理を開始")
-        
+
         if self.defines:
             self.logger.info(f"事前定義されたマクロ: {list(self.defines.keys())}")
-        
+
+        # v5.8.0: キャッシュの確認（入力コードとマクロ環境がキー、
+        # 展開したヘッダの内容ハッシュで有効性を検証）
+        cache_key = None
+        if self.cache is not None:
+            cache_key = self.cache.make_key(code, {
+                'defines': self.defines,
+                'include_paths': self.include_paths,
+                'enable_includes': self.enable_includes,
+            })
+            entry = self.cache.get(cache_key)
+            if entry is not None:
+                self._restore_from_cache_entry(entry)
+                self.logger.info("前処理結果をキャッシュから復元")
+                return entry['code']
+
         # v4.8.2: 処理順序を変更
         # 1. 元のコメントを削除
         code = self._remove_comments(code)
@@ -95,8 +116,52 @@ class Preprocessor:
                 self.logger.debug(f"  {name}({', '.join(params)})")
         
         self.logger.info("前処理が完了")
+
+        # v5.8.0: 結果と前処理状態をキャッシュに保存
+        if self.cache is not None and cache_key is not None:
+            self.cache.put(cache_key, self._build_cache_entry(code),
+                           self.included_file_paths)
+
         return code
-    
+
+    def _build_cache_entry(self, code: str) -> Dict[str, Any]:
+        """
+        キャッシュエントリを構築する (v5.8.0)
+
+        前処理済みコードに加えて、呼び出し側がgetterで参照する
+        前処理状態（マクロ定義・関数マクロ・ビットフィールド）も保存する。
+
+        Args:
+            code: 前処理済みコード
+
+        Returns:
+            キャッシュエントリの辞書
+        """
+        return {
+            'code': code,
+            'defines': dict(self.defines),
+            'function_macros': {name: [params, body]
+                                for name, (params, body) in self.function_macros.items()},
+            'bitfields': {name: list(info)
+                          for name, info in self.bitfields.items()},
+            'included_files': sorted(self.included_files),
+        }
+
+    def _restore_from_cache_entry(self, entry: Dict[str, Any]) -> None:
+        """
+        キャッシュエントリから前処理状態を復元する (v5.8.0)
+
+        Args:
+            entry: キャッシュエントリの辞書
+        """
+        self.defines = dict(entry.get('defines') or {})
+        self.function_macros = {name: (list(params), body)
+                                for name, (params, body)
+                                in (entry.get('function_macros') or {}).items()}
+        self.bitfields = {name: tuple(info)
+                          for name, info in (entry.get('bitfields') or {}).items()}
+        self.included_files = set(entry.get('included_files') or [])
+
     def _remove_comments(self, code: str) -> str:
         """
         コメントを削除
@@ -818,7 +883,9 @@ class Preprocessor:
                     
                     # インクルード済みとしてマーク
                     self.included_files.add(header_file)
-                    
+                    # v5.8.0: キャッシュの依存検証用に解決済みパスを記録
+                    self.included_file_paths[header_file] = file_path
+
                     content = read_file(file_path, encoding='auto')
                     
                     # ヘッダーファイルの内容も前処理（再帰的に処理）
@@ -0,0 +1,145 @@
+"""
+BuildManifestGeneratorモジュール
+
+生成済みハーネス群の並列ビルドマニフェスト（Makefile）を生成 (v5.5.0)
+
+ハーネスごとにunity.cを再コンパイルする代わりに、unity.cを1回だけ
+libunity.aにコンパイルし、unity.hをプリコンパイルヘッダ化した上で、
+全ハーネスをそれらに対してビルドするMakefileを出力する。
+-jによる完全な並列ビルドと正しいインクリメンタル依存関係を持ち、
+生成ソースと一緒に再生成されることを前提とする（CI側の手作業は不要）。
+"""
+
+import sys
+import os
+from typing import List, Optional
+
+# パスを追加
+sys.path.insert(0, os.path.join(os.path.dirname(__file__), '../..'))
+from src.utils import setup_logger
+
+
+class BuildManifestGenerator:
+    """ビルドマニフェスト（Makefile）ジェネレータ"""
+
+    def __init__(self, unity_dir: str = "output", cc: str = "gcc",
+                 cflags: Optional[str] = None):
+        """
+        初期化
+
+        Args:
+            unity_dir: unity.c/unity.h/unity_internals.hのあるディレクトリ
+            cc: Cコンパイラ
+            cflags: 追加のコンパイルフラグ（Noneでデフォルト）
+        """
+        self.logger = setup_logger(__name__)
+        self.unity_dir = unity_dir
+        self.cc = cc
+        self.cflags = cflags if cflags is not None else "-Wall -Wextra -O2"
+
+    def generate_makefile(self, test_sources: List[str]) -> str:
+        """
+        Makefileの内容を生成
+
+        Args:
+            test_sources: 生成されたテストソースファイル名のリスト
+                （マニフェストと同じディレクトリからの相対パス）
+
+        Returns:
+            Makefileの内容
+        """
+        # 拡張子を除いたバイナリ名
+        targets = [os.path.splitext(os.path.basename(src))[0] for src in test_sources]
+
+        lines = []
+        lines.append("# 自動生成されたビルドマニフェスト (v5.5.0)")
+        lines.append("#")
+        lines.append("# unity.cは1回だけlibunity.aにコンパイルされ、unity.hは")
+        lines.append("# プリコンパイルされる。全ハーネスはそれらに対してビルドされる。")
+        lines.append("# 例: make -j$(nproc) && make test")
+        lines.append("")
+        lines.append(f"CC        := {self.cc}")
+        lines.append("AR        := ar")
+        lines.append(f"UNITY_DIR := {self.unity_dir}")
+        lines.append("BUILD_DIR := build")
+        lines.append("# プリコンパイルヘッダのあるBUILD_DIRを先に検索させる")
+        lines.append(f"CFLAGS    := {self.cflags} -I$(BUILD_DIR) -I$(UNITY_DIR)")
+        lines.append("")
+        lines.append(f"TESTS := {' '.join(targets)}")
+        lines.append("BINS  := $(addprefix $(BUILD_DIR)/,$(TESTS))")
+        lines.append("")
+        lines.append(".PHONY: all test clean")
+        lines.append("# 中間の.oを削除させない（インクリメンタルビルド用）")
+        lines.append(".SECONDARY:")
+        lines.append("")
+        lines.append("all: $(BINS)")
+        lines.append("")
+        lines.append("# 各ハーネスの実行（1つでも失敗すれば非0終了）")
+        lines.append("test: all")
+        lines.append("\t@status=0; \\")
+        lines.append("\tfor bin in $(BINS); do \\")
+        lines.append("\t\techo \"=== $$bin ===\"; \\")
+        lines.append("\t\t$$bin || status=1; \\")
+        lines.append("\tdone; \\")
+        lines.append("\texit $$status")
+        lines.append("")
+        lines.append("$(BUILD_DIR):")
+        lines.append("\tmkdir -p $(BUILD_DIR)")
+        lines.append("")
+        lines.append("# Unityは1回だけコンパイルして静的ライブラリ化")
+        lines.append("$(BUILD_DIR)/unity.o: $(UNITY_DIR)/unity.c $(UNITY_DIR)/unity.h \\")
+        lines.append("\t\t$(UNITY_DIR)/unity_internals.h | $(BUILD_DIR)")
+        lines.append("\t$(CC) $(CFLAGS) -c $< -o $@")
+        lines.append("")
+        lines.append("$(BUILD_DIR)/libunity.a: $(BUILD_DIR)/unity.o")
+        lines.append("\t$(AR) rcs $@ $^")
+        lines.append("")
+        lines.append("# unity.hのプリコンパイル（BUILD_DIR側が先に見つかるため全ハーネスで共有）")
+        lines.append("$(BUILD_DIR)/unity.h.gch: $(UNITY_DIR)/unity.h $(UNITY_DIR)/unity_internals.h | $(BUILD_DIR)")
+        lines.append("\t$(CC) $(CFLAGS) -x c-header $< -o $@")
+        lines.append("")
+        lines.append("# ハーネスのコンパイルとリンク")
+        lines.append("$(BUILD_DIR)/%.o: %.c $(BUILD_DIR)/unity.h.gch | $(BUILD_DIR)")
+        lines.append("\t$(CC) $(CFLAGS) -c $< -o $@")
+        lines.append("")
+        lines.append("$(BUILD_DIR)/%: $(BUILD_DIR)/%.o $(BUILD_DIR)/libunity.a")
+        lines.append("\t$(CC) $^ -o $@")
+        lines.append("")
+        lines.append("clean:")
+        lines.append("\trm -rf $(BUILD_DIR)")
+        lines.append("")
+
+        return '\n'.join(lines)
+
+    def write_makefile(self, output_dir: str, test_sources: List[str]) -> str:
+        """
+        Makefileを書き出す
+
+        Args:
+            output_dir: 出力ディレクトリ（生成テストソースと同じ場所）
+            test_sources: 生成されたテストソースファイル名のリスト
+
+        Returns:
+            書き出したMakefileのパス
+        """
+        path = os.path.join(output_dir, "Makefile")
+        with open(path, 'w', encoding='utf-8') as f:
+            f.write(self.generate_makefile(test_sources))
+
+        self.logger.info(
+            f"v5.5.0: ビルドマニフェストを書き出し: {path} "
+            f"({len(test_sources)}ハーネス)")
+        return path
+
+
+if __name__ == "__main__":
+    # BuildManifestGeneratorのテスト
+    print("=" * 70)
+    print("BuildManifestGenerator のテスト")
+    print("=" * 70)
+    print()
+
+    gen = BuildManifestGenerator(unity_dir="../output")
+    makefile = gen.generate_makefile(
+        ["test_Utf1_mcdc.c", "test_Utf2_mcdc.c", "test_Utf3_mcdc.c"])
+    print(makefile)
@@ -0,0 +1,254 @@
+"""
+FixtureBlobGeneratorモジュール
+
+大きなフィクスチャデータをバイナリサイドカーファイルに集約 (v5.4.0)
+
+生成Cコードに巨大なブレース初期化子を埋め込む代わりに、閾値を超える
+フィクスチャを1つのパックされたバイナリファイルへ書き出し、ハーネスが
+main()の先頭（UNITY_BEGIN前）で読み取り専用にmmapする。これにより
+コンパイル時間を削減し、並列実行されるハーネスプロセス間でページを
+共有できる（ファイルバックのマッピングのためゼロコピー）。
+"""
+
+import sys
+import os
+from typing import List, Optional
+
+# パスを追加
+sys.path.insert(0, os.path.join(os.path.dirname(__file__), '../..'))
+from src.utils import setup_logger, sanitize_identifier
+
+
+class FixtureBlobGenerator:
+    """フィクスチャバイナリサイドカージェネレータ"""
+
+    # フィクスチャの先頭アライメント（構造体データを格納しても安全な境界）
+    ALIGNMENT = 8
+
+    def __init__(self, threshold: int = 64):
+        """
+        初期化
+
+        Args:
+            threshold: この閾値（バイト数）以上のフィクスチャをサイドカーに移す
+        """
+        self.logger = setup_logger(__name__)
+        self.threshold = threshold
+        self._entries = []  # (マクロ名, オフセット, サイズ, 説明)
+        self._data = bytearray()
+
+    def has_fixtures(self) -> bool:
+        """サイドカーに移されたフィクスチャが存在するか"""
+        return len(self._entries) > 0
+
+    def reset(self) -> None:
+        """登録済みフィクスチャをクリア（ファイル単位の生成ごとに呼ぶ）"""
+        self._entries = []
+        self._data = bytearray()
+
+    def should_externalize(self, size: int) -> bool:
+        """
+        指定サイズのフィクスチャをサイドカーへ移すべきか判定
+
+        Args:
+            size: フィクスチャのバイト数
+
+        Returns:
+            閾値以上ならTrue
+        """
+        return size >= self.threshold
+
+    def add_fixture(self, name: str, data: bytes, description: str = "") -> str:
+        """
+        フィクスチャを登録し、オフセットマクロ名を返す
+
+        Args:
+            name: フィクスチャ名（変数名など、識別子化される）
+            data: バイナリデータ
+            description: コメント用の説明
+
+        Returns:
+            オフセットマクロ名（例: FIXTURE_UTV1_OFFSET）
+        """
+        # 次のフィクスチャ境界までパディング
+        padding = (-len(self._data)) % self.ALIGNMENT
+        self._data.extend(b'\x00' * padding)
+
+        offset = len(self._data)
+        self._data.extend(data)
+
+        macro_name = f"FIXTURE_{sanitize_identifier(name).upper()}_OFFSET"
+        # 同名フィクスチャは連番で区別
+        base = macro_name
+        seq = 2
+        while any(entry[0] == macro_name for entry in self._entries):
+            macro_name = base.replace('_OFFSET', f"_{seq}_OFFSET")
+            seq += 1
+
+        self._entries.append((macro_name, offset, len(data), description))
+        self.logger.info(
+            f"v5.4.0: フィクスチャをサイドカーに登録: {macro_name} "
+            f"(オフセット{offset}, {len(data)}バイト)")
+
+        return macro_name
+
+    def add_string_fixture(self, name: str, value: str) -> str:
+        """
+        文字列フィクスチャを登録（NUL終端付きで格納）
+
+        Args:
+            name: フィクスチャ名
+            value: 文字列（Cエスケープ解決済み）
+
+        Returns:
+            オフセットマクロ名
+        """
+        data = value.encode('utf-8') + b'\x00'
+        return self.add_fixture(name, data, f"文字列 ({len(value)}文字)")
+
+    def blob_filename(self, function_name: str) -> str:
+        """
+        サイドカーファイル名を生成
+
+        Args:
+            function_name: テスト対象関数名
+
+        Returns:
+            ファイル名（例: test_Utf1_fixtures.bin）
+        """
+        return f"test_{function_name}_fixtures.bin"
+
+    def write_blob(self, output_dir: str, function_name: str) -> Optional[str]:
+        """
+        サイドカーファイルを書き出す
+
+        Args:
+            output_dir: 出力ディレクトリ
+            function_name: テスト対象関数名
+
+        Returns:
+            書き出したファイルのパス（フィクスチャがない場合はNone）
+        """
+        if not self.has_fixtures():
+            return None
+
+        path = os.path.join(output_dir, self.blob_filename(function_name))
+        with open(path, 'wb') as f:
+            f.write(bytes(self._data))
+
+        self.logger.info(
+            f"v5.4.0: フィクスチャサイドカーを書き出し: {path} "
+            f"({len(self._data)}バイト, {len(self._entries)}個)")
+        return path
+
+    def generate_support_code(self, function_name: str) -> str:
+        """
+        mmapによるフィクスチャアクセス用のCコードを生成
+
+        Args:
+            function_name: テスト対象関数名
+
+        Returns:
+            サポートコード（フィクスチャがない場合は空文字列）
+        """
+        if not self.has_fixtures():
+            return ""
+
+        lines = []
+        lines.append("// ===== フィクスチャサイドカー (v5.4.0) =====")
+        lines.append("")
+        lines.append("#include <stdio.h>")
+        lines.append("#include <stdlib.h>")
+        lines.append("#include <sys/mman.h>")
+        lines.append("#include <sys/stat.h>")
+        lines.append("#include <fcntl.h>")
+        lines.append("#include <unistd.h>")
+        lines.append("")
+        lines.append("/**")
+        lines.append(" * 大きなフィクスチャはコンパイル済み初期化子ではなく、")
+        lines.append(f" * {self.blob_filename(function_name)} を読み取り専用でmmapして参照する。")
+        lines.append(" * ファイルバックの共有マッピングのため、並列実行される")
+        lines.append(" * ハーネスプロセス間で物理ページが共有される。")
+        lines.append(" */")
+
+        # オフセットマクロ
+        for macro_name, offset, size, description in self._entries:
+            comment = f"  // {size}バイト" + (f", {description}" if description else "")
+            lines.append(f"#define {macro_name} {offset}{comment}")
+        lines.append(f"#define FIXTURE_BLOB_SIZE {len(self._data)}")
+        lines.append("")
+
+        lines.append("static const unsigned char *fixture_blob_base = NULL;")
+        lines.append("")
+        lines.append("/**")
+        lines.append(" * フィクスチャサイドカーをmmapする（main()の先頭で1回呼ぶ）")
+        lines.append(" * 失敗時はテストを実行せずに異常終了する")
+        lines.append(" */")
+        lines.append("static void fixture_blob_map(const char *path) {")
+        lines.append("    struct stat st;")
+        lines.append("    int fd = open(path, O_RDONLY);")
+        lines.append("    if (fd < 0) {")
+        lines.append("        fprintf(stderr, \"ERROR: Cannot open fixture blob: %s\\n\", path);")
+        lines.append("        exit(1);")
+        lines.append("    }")
+        lines.append("    if (fstat(fd, &st) != 0 || st.st_size < (off_t)FIXTURE_BLOB_SIZE) {")
+        lines.append("        fprintf(stderr, \"ERROR: Fixture blob too small: %s\\n\", path);")
+        lines.append("        close(fd);")
+        lines.append("        exit(1);")
+        lines.append("    }")
+        lines.append("    fixture_blob_base = (const unsigned char *)mmap(")
+        lines.append("        NULL, (size_t)st.st_size, PROT_READ, MAP_SHARED, fd, 0);")
+        lines.append("    close(fd);  // マッピングはfdクローズ後も有効")
+        lines.append("    if (fixture_blob_base == MAP_FAILED) {")
+        lines.append("        fprintf(stderr, \"ERROR: Cannot mmap fixture blob: %s\\n\", path);")
+        lines.append("        exit(1);")
+        lines.append("    }")
+        lines.append("}")
+        lines.append("")
+        lines.append("/**")
+        lines.append(" * マッピング内のフィクスチャへのポインタを取得（ゼロコピー）")
+        lines.append(" */")
+        lines.append("static const void *fixture_blob_ptr(size_t offset) {")
+        lines.append("    return fixture_blob_base + offset;")
+        lines.append("}")
+
+        return '\n'.join(lines)
+
+    def generate_map_call(self, function_name: str) -> str:
+        """
+        main()に挿入するマッピング呼び出しを生成
+
+        Args:
+            function_name: テスト対象関数名
+
+        Returns:
+            呼び出しコード（フィクスチャがない場合は空文字列）
+        """
+        if not self.has_fixtures():
+            return ""
+        return f'    fixture_blob_map("{self.blob_filename(function_name)}");'
+
+
+if __name__ == "__main__":
+    # FixtureBlobGeneratorのテスト
+    print("=" * 70)
+    print("FixtureBlobGenerator のテスト")
+    print("=" * 70)
+    print()
+
+    gen = FixtureBlobGenerator(threshold=16)
+
+    print(f"1. 閾値判定: 8バイト -> {gen.should_externalize(8)}, "
+          f"32バイト -> {gen.should_externalize(32)}")
+    print()
+
+    macro1 = gen.add_string_fixture("Utv1", "A" * 32)
+    macro2 = gen.add_fixture("table_data", bytes(range(24)), "バイナリテーブル")
+    print(f"2. 登録: {macro1}, {macro2}")
+    print()
+
+    print("3. サポートコード:")
+    print(gen.generate_support_code("Utf1"))
+    print()
+    print("4. main()挿入コード:")
+    print(gen.generate_map_call("Utf1"))
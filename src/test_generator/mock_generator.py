@@ -6,6 +6,7 @@ v4.0: 元の関数と同じシグネチャでモックを生成（リンカ互
 v4.1.2: 構造体型変数の初期化をmemset対応
 v4.3.4: const維持、ポインタのメモリコピー対応
 v5.1.13: パススルーモック対応（入力値をそのまま返す関数）
+v5.2.0: 固定長リングバッファによる呼び出し記録と戻り値キュー（ヒープ不使用）
 """
 
 import sys
@@ -278,7 +279,14 @@ class MockGenerator:
             変数定義のコード
         """
         lines = ["// ===== モック・スタブ用グローバル変数 ====="]
-        
+
+        # v5.2.0: 呼び出し記録リングバッファの深さ（固定長・ヒープ不使用）
+        lines.append("")
+        lines.append("#ifndef MOCK_CALL_RECORD_DEPTH")
+        lines.append("#define MOCK_CALL_RECORD_DEPTH 16")
+        lines.append("#endif")
+        lines.append("")
+
         for mock_func in self.mock_functions:
             # 戻り値変数（void型でない場合のみ）
             if mock_func.return_type != "void":
@@ -303,9 +311,28 @@ class MockGenerator:
                     # 非ポインタ型: そのまま（constは除去）
                     non_const_type = self._remove_const_from_type(param_type)
                     lines.append(f"static {non_const_type} {param_var};")
-            
+
+            # v5.2.0: 呼び出し記録リングバッファ（引数がある関数のみ）
+            if mock_func.parameters:
+                lines.append(f"typedef struct {{")
+                for param in mock_func.parameters:
+                    if self._is_pointer_type(param['type']):
+                        # ポインタ引数は指し先のコピーを保持
+                        field_type = self._get_base_type(param['type'])
+                    else:
+                        field_type = self._remove_const_from_type(param['type'])
+                    lines.append(f"    {field_type} {param['name']};")
+                lines.append(f"}} mock_{mock_func.name}_call_record_t;")
+                lines.append(f"static mock_{mock_func.name}_call_record_t mock_{mock_func.name}_call_records[MOCK_CALL_RECORD_DEPTH];")
+
+            # v5.2.0: 戻り値キュー（void・パススルー以外）
+            if mock_func.return_type != "void" and not self.is_passthrough_function(mock_func.name):
+                lines.append(f"static {mock_func.return_type} mock_{mock_func.name}_return_queue[MOCK_CALL_RECORD_DEPTH];")
+                lines.append(f"static int mock_{mock_func.name}_return_queue_length;")
+                lines.append(f"static int mock_{mock_func.name}_return_queue_index;")
+
             lines.append("")
-        
+
         return '\n'.join(lines)
     
     def generate_mock_functions(self) -> str:
@@ -342,13 +369,13 @@ class MockGenerator:
             # v4.3.4.1: static修飾子を追加
             lines.append(f"static {mock_func.return_type} {mock_func.name}({params_str}) {{")
             lines.append(f"    {mock_func.call_count_variable}++;")
-            
+
             # パラメータをキャプチャ（v4.3.4: ポインタはmemcpy）
             for param in mock_func.parameters:
                 param_var = f"mock_{mock_func.name}_param_{param['name']}"
                 param_type = param['type']
                 param_name = param['name']
-                
+
                 if self._is_pointer_type(param_type):
                     # ポインタ型: NULLチェック + memcpy
                     base_type = self._get_base_type(param_type)
@@ -360,7 +387,23 @@ class MockGenerator:
                 else:
                     # 非ポインタ型: 単純コピー
                     lines.append(f"    {param_var} = {param_name};")
-            
+
+            # v5.2.0: 呼び出し記録をリングバッファへ書き込み（O(1)・ヒープ不使用）
+            if mock_func.parameters:
+                lines.append(f"    {{")
+                lines.append(f"        mock_{mock_func.name}_call_record_t *rec = &mock_{mock_func.name}_call_records[({mock_func.call_count_variable} - 1) % MOCK_CALL_RECORD_DEPTH];")
+                for param in mock_func.parameters:
+                    param_name = param['name']
+                    if self._is_pointer_type(param['type']):
+                        base_type = self._get_base_type(param['type'])
+                        lines.append(f"        if ({param_name} != NULL) {{")
+                        lines.append(f"            memcpy(&rec->{param_name}, {param_name}, sizeof({base_type}));")
+                        lines.append(f"        }}")
+                        self._needs_string_h = True  # memcpy使用
+                    else:
+                        lines.append(f"        rec->{param_name} = {param_name};")
+                lines.append(f"    }}")
+
             # void型でない場合のみreturn文を生成
             if mock_func.return_type != "void":
                 # v5.1.13: パススルー関数は第1引数をそのまま返す
@@ -368,10 +411,43 @@ class MockGenerator:
                     first_param = mock_func.parameters[0]['name']
                     lines.append(f"    return {first_param};  // パススルー")
                 else:
+                    # v5.2.0: 戻り値キューを優先消費し、空なら従来の固定値
+                    lines.append(f"    if (mock_{mock_func.name}_return_queue_index < mock_{mock_func.name}_return_queue_length) {{")
+                    lines.append(f"        return mock_{mock_func.name}_return_queue[mock_{mock_func.name}_return_queue_index++];")
+                    lines.append(f"    }}")
                     lines.append(f"    return {mock_func.return_variable};")
             lines.append(f"}}")
             lines.append("")
-        
+
+            # v5.2.0: 検証用ヘルパー
+            if mock_func.parameters:
+                lines.append(f"/**")
+                lines.append(f" * {mock_func.name}のn回目(0始まり)の呼び出し記録を取得")
+                lines.append(f" * 未呼び出し・リングバッファから押し出された記録はNULL")
+                lines.append(f" * （任意利用のヘルパー。未参照でも警告が出ないようstatic inline）")
+                lines.append(f" */")
+                lines.append(f"static inline const mock_{mock_func.name}_call_record_t *mock_{mock_func.name}_get_call(int call_index) {{")
+                lines.append(f"    if (call_index < 0 || call_index >= {mock_func.call_count_variable}) {{")
+                lines.append(f"        return NULL;")
+                lines.append(f"    }}")
+                lines.append(f"    if (call_index < {mock_func.call_count_variable} - MOCK_CALL_RECORD_DEPTH) {{")
+                lines.append(f"        return NULL;  // 上書き済み")
+                lines.append(f"    }}")
+                lines.append(f"    return &mock_{mock_func.name}_call_records[call_index % MOCK_CALL_RECORD_DEPTH];")
+                lines.append(f"}}")
+                lines.append("")
+            if mock_func.return_type != "void" and not is_passthrough:
+                lines.append(f"/**")
+                lines.append(f" * {mock_func.name}の戻り値をキューへ追加（満杯時は無視）")
+                lines.append(f" * （任意利用のヘルパー。未参照でも警告が出ないようstatic inline）")
+                lines.append(f" */")
+                lines.append(f"static inline void mock_{mock_func.name}_enqueue_return({mock_func.return_type} value) {{")
+                lines.append(f"    if (mock_{mock_func.name}_return_queue_length < MOCK_CALL_RECORD_DEPTH) {{")
+                lines.append(f"        mock_{mock_func.name}_return_queue[mock_{mock_func.name}_return_queue_length++] = value;")
+                lines.append(f"    }}")
+                lines.append(f"}}")
+                lines.append("")
+
         return '\n'.join(lines)
     
     def generate_reset_function(self) -> str:
@@ -422,9 +498,17 @@ class MockGenerator:
                     init_code = self._get_init_code(param_var, non_const_type)
                     if init_code:
                         lines.append(f"    {init_code}")
-        
+
+            # v5.2.0: 呼び出し記録リングバッファと戻り値キューをリセット
+            if mock_func.parameters:
+                lines.append(f"    memset(mock_{mock_func.name}_call_records, 0, sizeof(mock_{mock_func.name}_call_records));")
+                self._needs_string_h = True  # memset使用
+            if mock_func.return_type != "void" and not self.is_passthrough_function(mock_func.name):
+                lines.append(f"    mock_{mock_func.name}_return_queue_length = 0;")
+                lines.append(f"    mock_{mock_func.name}_return_queue_index = 0;")
+
         lines.append("}")
-        
+
         return '\n'.join(lines)
     
     def generate_prototypes(self) -> str:
@@ -20,6 +20,9 @@ class PrototypeGenerator:
     def __init__(self):
         """初期化"""
         self.logger = setup_logger(__name__)
+        # v5.6.1: スイートモードではsetUp/tearDownの代わりに
+        # <関数名>_suite_setUp/<関数名>_suite_tearDownを宣言する
+        self.suite_mode = False
     
     def generate_prototypes(self, truth_table: TruthTableData, parsed_data: ParsedData) -> str:
         """
@@ -53,7 +56,7 @@ class PrototypeGenerator:
         
         # 3. ヘルパー関数のプロトタイプ
         lines.append("// ヘルパー関数")
-        helper_protos = self._generate_helper_prototypes()
+        helper_protos = self._generate_helper_prototypes(parsed_data.function_name)
         lines.extend(helper_protos)
         
         self.logger.info("プロトタイプ宣言の生成が完了")
@@ -110,19 +113,28 @@ class PrototypeGenerator:
         
         return protos
     
-    def _generate_helper_prototypes(self) -> List[str]:
+    def _generate_helper_prototypes(self, function_name: str) -> List[str]:
         """
         ヘルパー関数のプロトタイプを生成
-        
+
+        Args:
+            function_name: テスト対象関数名（スイートモードの宣言名に使用）
+
         Returns:
             プロトタイプのリスト
         """
         protos = []
-        
+
         # setUp/tearDown
-        protos.append("static void setUp(void);")
-        protos.append("static void tearDown(void);")
-        
+        # v5.6.1: スイートモードではunity.hが宣言するsetUp/tearDownは
+        # 結合ランナー側で定義されるため、スイート専用の関数を宣言する
+        if self.suite_mode:
+            protos.append(f"static void {function_name}_suite_setUp(void);")
+            protos.append(f"static void {function_name}_suite_tearDown(void);")
+        else:
+            protos.append("static void setUp(void);")
+            protos.append("static void tearDown(void);")
+
         return protos
     
     def _guess_return_type(self, func_name: str) -> str:
@@ -8,6 +8,8 @@ v4.2.0: ローカル変数/構造体メンバー/数値リテラル対応
 v4.3.1: ローカル変数へのアクセスをTODOコメント化、構造体メンバーパス抽出を修正
 v4.3.3.1: AssignableVariableCheckerによる代入可能判定の一元化
 v4.5: 配列変数への直接代入防止、条件式からの配列変数検出
+v5.3.0: 同一呼び出し形状のテストケースをテーブル駆動形式で集約するモードを追加
+v5.4.0: 閾値以上の文字列フィクスチャをバイナリサイドカー参照に置換
 """
 
 import sys
@@ -33,6 +35,12 @@ class TestFunctionGenerator:
         self.logger = setup_logger(__name__)
         self.boundary_calc = BoundaryValueCalculator()
         self.comment_gen = CommentGenerator()
+        self.fixture_blob = None  # v5.4.0: フィクスチャサイドカー（有効時に外部から設定）
+        # v5.6.1: スイートモードではテスト関数をstaticで生成する。
+        # 複数ハーネスを1バイナリにリンクするため、条件文が同じ別関数の
+        # ハーネス同士で外部シンボル名が衝突しないように内部結合にする
+        # （RUN_TEST参照はすべて同一翻訳単位のスイートエントリ内にある）。
+        self.suite_mode = False
     
     def generate_test_function(self, test_case: TestCase, parsed_data: ParsedData) -> str:
         """
@@ -54,8 +62,9 @@ class TestFunctionGenerator:
         # 関数名を生成
         func_name = self._generate_test_name(test_case, parsed_data)
         
-        # 関数定義
-        lines.append(f"void {func_name}(void) {{")
+        # 関数定義（スイートモードでは内部結合）
+        storage = "static " if self.suite_mode else ""
+        lines.append(f"{storage}void {func_name}(void) {{")
         
         # 変数初期化
         init_code = self._generate_variable_init(test_case, parsed_data)
@@ -96,6 +105,362 @@ class TestFunctionGenerator:
         
         return '\n'.join(lines)
     
+    def generate_table_driven_function(self, test_cases: List[TestCase],
+                                       parsed_data: ParsedData) -> Optional[tuple]:
+        """
+        同一の呼び出し形状を持つテストケース群をテーブル駆動形式で1関数に集約 (v5.3.0)
+
+        各行の変数初期化が単純代入のみで構成され、代入先の集合が全行で一致する場合に、
+        static const のテーブルと行ループを持つ1つのテスト関数を生成する。
+        集約できない場合は None を返し、呼び出し側が従来の行ごとの関数生成にフォールバックする。
+
+        Args:
+            test_cases: 同一条件のテストケースのリスト（2件以上）
+            parsed_data: 解析済みデータ
+
+        Returns:
+            (関数名, コード) のタプル、集約できない場合は None
+        """
+        if len(test_cases) < 2:
+            return None
+
+        # 各行から代入内容を抽出
+        rows = []
+        for test_case in test_cases:
+            row = self._extract_table_row(test_case, parsed_data)
+            if row is None:
+                return None
+            rows.append(row)
+
+        # 代入先の集合が全行で一致することを確認（グローバル変数側）
+        first_lhs = tuple(lhs for lhs, _, _ in rows[0]['assigns'])
+        for row in rows[1:]:
+            if tuple(lhs for lhs, _, _ in row['assigns']) != first_lhs:
+                return None
+
+        # モック戻り値は全行の和集合を取る（未設定の行は0 = reset後のデフォルト値）
+        mock_lhs = []
+        for row in rows:
+            for lhs, _, _ in row['mock_assigns']:
+                if lhs not in mock_lhs:
+                    mock_lhs.append(lhs)
+
+        # 戻り値以外のアサーションと呼び出し回数チェックは全行で同一であること
+        for row in rows[1:]:
+            if row['other_assertions'] != rows[0]['other_assertions']:
+                return None
+            if row['call_count_check'] != rows[0]['call_count_check']:
+                return None
+            if row['result_decl'] != rows[0]['result_decl']:
+                return None
+
+        # 期待戻り値列は全行で算出できた場合のみ追加
+        has_expected = all(row['expected'] is not None for row in rows)
+
+        # 構造体フィールド名（代入先から識別子化、衝突時はフォールバック）
+        all_lhs = list(first_lhs) + mock_lhs
+        field_names = []
+        for lhs in all_lhs:
+            field = sanitize_identifier(lhs)
+            if field in field_names:
+                return None
+            field_names.append(field)
+
+        if not all_lhs and not has_expected:
+            # テーブル化する列がない
+            return None
+
+        # 関数名: test_[先頭番号]_[判定文]_table
+        func_name = self._generate_table_test_name(test_cases[0], parsed_data)
+
+        lines = []
+
+        # ヘッダコメント
+        condition = test_cases[0].condition
+        row_desc = ', '.join(f"No.{tc.no}({tc.truth})" for tc in test_cases)
+        lines.append("/**")
+        lines.append(f" * テーブル駆動テスト: {condition}")
+        lines.append(f" * 対象行: {row_desc}")
+        lines.append(" */")
+
+        # 行構造体
+        lines.append("typedef struct {")
+        lines.append("    int no;             // 真偽表の行番号")
+        lines.append("    const char *truth;  // 真偽パターン")
+        for lhs, field in zip(all_lhs, field_names):
+            field_type = self._lookup_table_field_type(lhs, rows, parsed_data)
+            lines.append(f"    {field_type} {field};")
+        if has_expected:
+            return_type = parsed_data.function_info.return_type
+            lines.append(f"    {return_type} expected_result;  // 期待される戻り値")
+        lines.append(f"}} {func_name}_row_t;")
+        lines.append("")
+
+        # 行テーブル
+        lines.append(f"static const {func_name}_row_t {func_name}_rows[] = {{")
+        for test_case, row in zip(test_cases, rows):
+            values = [str(test_case.no), f'"{test_case.truth}"']
+            value_map = {lhs: value for lhs, value, _ in
+                         row['assigns'] + row['mock_assigns']}
+            for lhs in all_lhs:
+                values.append(value_map.get(lhs, '0'))
+            if has_expected:
+                values.append(row['expected'])
+            lines.append(f"    {{ {', '.join(values)} }},")
+        lines.append("};")
+        lines.append("")
+
+        # テスト関数本体（スイートモードでは内部結合）
+        storage = "static " if self.suite_mode else ""
+        lines.append(f"{storage}void {func_name}(void) {{")
+        lines.append("    size_t row;")
+        lines.append(f"    for (row = 0; row < sizeof({func_name}_rows) / sizeof({func_name}_rows[0]); row++) {{")
+        lines.append(f"        const {func_name}_row_t *entry = &{func_name}_rows[row];")
+        lines.append("        char row_msg[64];")
+        if rows[0]['result_decl']:
+            lines.append(f"        {rows[0]['result_decl']}")
+        lines.append("        sprintf(row_msg, \"row %u (No.%d, %s)\", (unsigned)row, entry->no, entry->truth);")
+        lines.append("")
+
+        if parsed_data.external_functions:
+            lines.append("        // 行ごとにモック状態をリセット")
+            lines.append("        reset_all_mocks();")
+            lines.append("")
+
+        if first_lhs or mock_lhs:
+            lines.append("        // 変数を初期化")
+            for lhs, field in zip(all_lhs, field_names):
+                lines.append(f"        {lhs} = entry->{field};")
+            lines.append("")
+
+        lines.append("        // 対象関数を実行")
+        param_str = self._build_function_call_params(parsed_data)
+        if rows[0]['result_decl']:
+            lines.append(f"        result = {parsed_data.function_name}({param_str});")
+        else:
+            lines.append(f"        {parsed_data.function_name}({param_str});")
+        lines.append("")
+
+        # アサーション（行番号付きメッセージ）
+        row_msg_used = False
+        lines.append("        // 結果を確認（失敗時は行番号をメッセージに出力）")
+        if has_expected:
+            lines.append("        TEST_ASSERT_EQUAL_MESSAGE(entry->expected_result, result, row_msg);")
+            row_msg_used = True
+        for assert_line in rows[0]['other_assertions']:
+            converted = self._convert_assert_to_message(assert_line)
+            if converted != assert_line:
+                row_msg_used = True
+            lines.append(f"        {converted}")
+        for check_line in rows[0]['call_count_check']:
+            lines.append(f"        {check_line}")
+        if not row_msg_used:
+            lines.append("        (void)row_msg;  // アサーション追加時にメッセージとして使用")
+        lines.append("    }")
+        lines.append("}")
+
+        return func_name, '\n'.join(lines)
+
+    def _generate_table_test_name(self, first_case: TestCase, parsed_data: ParsedData) -> str:
+        """
+        テーブル駆動テストの関数名を生成 (v5.3.0)
+
+        ルール: test_[先頭番号]_[判定文]_table
+
+        Args:
+            first_case: グループ先頭のテストケース
+            parsed_data: 解析済みデータ
+
+        Returns:
+            テスト関数名
+        """
+        test_no = f"{first_case.no:02d}"
+
+        matching_condition = None
+        for cond in parsed_data.conditions:
+            if cond.expression in first_case.condition:
+                matching_condition = cond
+                break
+
+        if matching_condition:
+            condition_part = self._extract_condition_identifier(matching_condition)
+        else:
+            condition_part = "condition"
+
+        func_name = sanitize_identifier(f"test_{test_no}_{condition_part}_table")
+
+        if len(func_name) > 60:
+            func_name = func_name[:54] + "_table"
+
+        return func_name
+
+    def _extract_table_row(self, test_case: TestCase,
+                           parsed_data: ParsedData) -> Optional[Dict]:
+        """
+        テストケース1行分のテーブル行情報を抽出 (v5.3.0)
+
+        変数初期化とモック設定が単純代入のみで構成される場合に、
+        代入先と値の組を抽出する。宣言を伴う初期化（result以外）や
+        代入以外のコードが含まれる場合は None を返す。
+
+        Args:
+            test_case: テストケース
+            parsed_data: 解析済みデータ
+
+        Returns:
+            抽出結果の辞書、テーブル化できない場合は None
+        """
+        # 単純代入: 識別子（メンバーアクセス/配列添字可） = 値;
+        assign_re = re.compile(
+            r'^\s*([A-Za-z_][A-Za-z0-9_]*(?:(?:\.|->)[A-Za-z_][A-Za-z0-9_]*|\[[0-9]+\])*)'
+            r'\s*=\s*(.+?);\s*(?://\s*(.*))?$')
+
+        def parse_assigns(code: str) -> Optional[List[tuple]]:
+            assigns = []
+            for line in code.split('\n'):
+                stripped = line.strip()
+                if not stripped or stripped.startswith('//'):
+                    continue
+                m = assign_re.match(line)
+                if not m:
+                    return None
+                assigns.append((m.group(1), m.group(2), m.group(3) or ''))
+            return assigns
+
+        result_decl = ''
+        init_lines = []
+        init_code = self._generate_variable_init(test_case, parsed_data)
+        for line in init_code.split('\n'):
+            stripped = line.strip()
+            # result変数の宣言はループ内に移動するため分離
+            if re.match(r'^\S.*\bresult\s*=', stripped) and not stripped.startswith('result'):
+                result_decl = stripped
+                continue
+            init_lines.append(line)
+
+        assigns = parse_assigns('\n'.join(init_lines))
+        if assigns is None:
+            return None
+
+        mock_setup = self._generate_mock_setup(test_case, parsed_data)
+        mock_assigns = parse_assigns(mock_setup) if mock_setup else []
+        if mock_assigns is None:
+            return None
+
+        # 期待戻り値（void以外で算出できた場合のみ）
+        expected = None
+        if parsed_data.function_info and parsed_data.function_info.return_type != 'void':
+            expected = self._calculate_expected_return_value(test_case, parsed_data)
+
+        # 戻り値アサーション以外のアサーション行（全行で同一であることを後段で確認）
+        other_assertions = []
+        assertions = self._generate_assertions(test_case, parsed_data)
+        for line in assertions.split('\n'):
+            stripped = line.strip()
+            if not stripped:
+                continue
+            if expected is not None and stripped == f"TEST_ASSERT_EQUAL({expected}, result);":
+                continue
+            # 見出しコメントはテーブル駆動側で出力するため除外
+            if stripped == "// 結果を確認":
+                continue
+            other_assertions.append(stripped)
+
+        call_count_check = []
+        check_code = self._generate_call_count_check(test_case, parsed_data)
+        if check_code:
+            call_count_check = [l.strip() for l in check_code.split('\n') if l.strip()]
+
+        return {
+            'assigns': assigns,
+            'mock_assigns': mock_assigns,
+            'result_decl': result_decl,
+            'expected': expected,
+            'other_assertions': other_assertions,
+            'call_count_check': call_count_check,
+        }
+
+    def _lookup_table_field_type(self, lhs: str, rows: List[Dict],
+                                 parsed_data: ParsedData) -> str:
+        """
+        テーブル行構造体のフィールド型を決定 (v5.3.0)
+
+        Args:
+            lhs: 代入先（変数名/モック戻り値変数名）
+            rows: 全行の抽出結果
+            parsed_data: 解析済みデータ
+
+        Returns:
+            型名（特定できない場合は int）
+        """
+        # 文字列リテラル/NULLを格納する列はポインタ型
+        for row in rows:
+            for l, value, _ in row['assigns'] + row['mock_assigns']:
+                if l == lhs and (value.startswith('"') or value == 'NULL'):
+                    return 'const char *'
+
+        # モック戻り値変数は関数シグネチャから型を引く
+        m = re.match(r'^mock_(\w+)_return_value$', lhs)
+        if m:
+            for sig in getattr(parsed_data, 'function_signatures', []):
+                if sig.name == m.group(1):
+                    return sig.return_type
+            return 'int'
+
+        # グローバル/static変数は宣言情報から型を引く
+        for var_info in (list(getattr(parsed_data, 'static_variables', [])) +
+                         list(getattr(parsed_data, 'global_variable_infos', []))):
+            if var_info.name == lhs:
+                return var_info.var_type
+
+        return 'int'
+
+    def _externalize_string_fixture(self, param_name: str, literal: str) -> Optional[str]:
+        """
+        文字列フィクスチャをサイドカーへ移した初期化コードを生成 (v5.4.0)
+
+        フィクスチャサイドカーが有効で、文字列が閾値以上の場合に、
+        mmapされたサイドカー内を指すポインタ宣言を返す。
+        エスケープシーケンスを含む文字列はバイト数が確定しないため対象外。
+
+        Args:
+            param_name: パラメータ名
+            literal: 文字列リテラル（引用符付き）
+
+        Returns:
+            初期化コード、サイドカーへ移さない場合は None
+        """
+        if self.fixture_blob is None:
+            return None
+
+        # 引用符を除いた内容（エスケープを含む場合は対象外）
+        content = literal[1:-1]
+        if '\\' in content:
+            return None
+        if not self.fixture_blob.should_externalize(len(content) + 1):
+            return None
+
+        macro_name = self.fixture_blob.add_string_fixture(param_name, content)
+        return (f"    // v5.4.0: 大きなフィクスチャはサイドカーから参照（ゼロコピー）\n"
+                f"    const char *{param_name} = "
+                f"(const char *)fixture_blob_ptr({macro_name});")
+
+    def _convert_assert_to_message(self, assert_line: str) -> str:
+        """
+        アサーションを行番号メッセージ付きに変換 (v5.3.0)
+
+        Args:
+            assert_line: アサーション行
+
+        Returns:
+            _MESSAGE版のアサーション（変換できない場合はそのまま）
+        """
+        if (assert_line.startswith('TEST_ASSERT_') and
+                '_MESSAGE' not in assert_line and
+                assert_line.endswith(');')):
+            return assert_line[:-2] + ', row_msg);'
+        return assert_line
+
     def _build_function_call_params(self, parsed_data: ParsedData) -> str:
         """
         対象関数呼び出し時のパラメータ文字列を構築（v4.1.3追加）
@@ -270,7 +635,12 @@ class TestFunctionGenerator:
                         init_value = param_init_values[param_name]
                         # 文字列リテラルの場合は配列形式で宣言
                         if init_value.startswith('"'):
-                            lines.append(f"    const char {param_name}[] = {init_value};")
+                            # v5.4.0: 閾値以上の文字列はサイドカーから参照
+                            blob_init = self._externalize_string_fixture(param_name, init_value)
+                            if blob_init:
+                                lines.append(blob_init)
+                            else:
+                                lines.append(f"    const char {param_name}[] = {init_value};")
                         elif init_value == 'NULL':
                             # NULLの場合はポインタとして宣言（テスト目的でNULLを渡す場合）
                             lines.append(f"    const char* {param_name} = NULL;")
@@ -282,7 +652,13 @@ class TestFunctionGenerator:
                             lines.append(f"    const char {param_name}[] = {{{init_value}, 0}};")
                         else:
                             # その他（文字列として扱う）
-                            lines.append(f"    const char {param_name}[] = \"{init_value}\";")
+                            # v5.4.0: 閾値以上の文字列はサイドカーから参照
+                            blob_init = self._externalize_string_fixture(
+                                param_name, f"\"{init_value}\"")
+                            if blob_init:
+                                lines.append(blob_init)
+                            else:
+                                lines.append(f"    const char {param_name}[] = \"{init_value}\";")
                     else:
                         # デフォルトは空文字列
                         lines.append(f"    const char {param_name}[] = \"\";")
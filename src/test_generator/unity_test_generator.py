@@ -6,6 +6,21 @@ UnityTestGeneratorモジュール
 v4.4:
 - テスト対象関数をstaticに変換する機能を追加
 - 外部関数のプロトタイプ宣言だけでなく、テスト対象関数もstaticに変換
+
+v5.3.0:
+- table_driven指定時に同一条件のテストケースをテーブル駆動形式で集約
+
+v5.4.0:
+- fixture_blob_threshold指定時に大きなフィクスチャをバイナリサイドカーへ移動
+  （ハーネスはmain()先頭で読み取り専用mmap、ゼロコピー参照）
+
+v5.6.0:
+- suite_mode指定時にmain()の代わりにスイートエントリ関数を生成し、
+  generate_combined_runner()で複数スイートを1バイナリ・1プロセスで実行
+
+v5.7.0:
+- branch_coverage指定時に対象関数のif条件へ軽量なヒットカウンタを埋め込み、
+  同一ランから分岐カバレッジの根拠を出力（gcovによる再実行が不要）
 """
 
 import sys
@@ -15,23 +30,33 @@ from typing import Optional, List
 # パスを追加
 sys.path.insert(0, os.path.join(os.path.dirname(__file__), '../..'))
 from src.utils import setup_logger
-from src.data_structures import ParsedData, TruthTableData, TestCode, TestCase
+from src.data_structures import ParsedData, TruthTableData, TestCode, TestCase, ConditionType
 from src.test_generator.mock_generator import MockGenerator
 from src.test_generator.test_function_generator import TestFunctionGenerator
 from src.test_generator.prototype_generator import PrototypeGenerator
 from src.test_generator.comment_generator import CommentGenerator
+from src.test_generator.fixture_blob_generator import FixtureBlobGenerator  # v5.4.0
 from src.code_extractor.code_extractor import CodeExtractor  # v2.2: 関数抽出機能
 
 
 class UnityTestGenerator:
     """Unityテストジェネレータ"""
     
-    def __init__(self, include_target_function: bool = True):
+    def __init__(self, include_target_function: bool = True, table_driven: bool = False,
+                 fixture_blob_threshold: Optional[int] = None, suite_mode: bool = False,
+                 branch_coverage: bool = False):
         """
         初期化
-        
+
         Args:
             include_target_function: テスト対象関数の本体を含めるか（v2.2の新機能）
+            table_driven: 同一条件のテストケースをテーブル駆動形式で集約するか（v5.3.0）
+            fixture_blob_threshold: このバイト数以上のフィクスチャをバイナリ
+                サイドカーに移してmmapで参照する（v5.4.0、Noneで無効）
+            suite_mode: main()の代わりにスイートエントリ関数を生成し、
+                複数スイートを1バイナリにリンクできるようにする（v5.6.0）
+            branch_coverage: 対象関数のif条件に軽量なヒットカウンタを
+                埋め込み、実行終了時にカバレッジを出力する（v5.7.0）
         """
         self.logger = setup_logger(__name__)
         self.mock_gen = MockGenerator()
@@ -40,6 +65,20 @@ class UnityTestGenerator:
         self.comment_gen = CommentGenerator()
         self.code_extractor = CodeExtractor()  # v2.2: 関数抽出機能
         self.include_target_function = include_target_function  # v2.2
+        self.table_driven = table_driven  # v5.3.0
+        self._table_func_names = {}  # v5.3.0: テストケース番号 -> テーブル駆動関数名
+
+        self.suite_mode = suite_mode  # v5.6.0
+        self.test_func_gen.suite_mode = suite_mode  # v5.6.1: テスト関数をstatic化
+        self.proto_gen.suite_mode = suite_mode  # v5.6.1: setUp/tearDown宣言の切替
+        self.branch_coverage = branch_coverage  # v5.7.0
+        self._instrumented_conditions = []  # v5.7.0: (インデックス, 条件式, 行番号)
+
+        # v5.4.0: フィクスチャサイドカー
+        self.fixture_blob_gen = None
+        if fixture_blob_threshold is not None:
+            self.fixture_blob_gen = FixtureBlobGenerator(threshold=fixture_blob_threshold)
+            self.test_func_gen.fixture_blob = self.fixture_blob_gen
     
     def generate(self, truth_table: TruthTableData, parsed_data: ParsedData, 
                  source_code: Optional[str] = None) -> TestCode:
@@ -80,7 +119,17 @@ class UnityTestGenerator:
             test_code.mock_functions = mock_code
         
         # 6. テスト関数群
+        # v5.4.0: フィクスチャサイドカーの登録はテスト関数生成中に行われる
+        if self.fixture_blob_gen:
+            self.fixture_blob_gen.reset()
         test_code.test_functions = self._generate_all_test_functions(truth_table, parsed_data)
+
+        # v5.4.0: サイドカーへ移されたフィクスチャがあればmmapサポートコードを追加
+        if self.fixture_blob_gen and self.fixture_blob_gen.has_fixtures():
+            support_code = self.fixture_blob_gen.generate_support_code(parsed_data.function_name)
+            test_code.type_definitions = (
+                test_code.type_definitions + "\n\n" + support_code
+                if test_code.type_definitions else support_code)
         
         # 7. setUp/tearDown (v5.0.0: static/global変数初期化追加)
         test_code.setup_teardown = self._generate_setup_teardown(parsed_data)
@@ -90,6 +139,14 @@ class UnityTestGenerator:
             self.logger.info("v2.2: テスト対象関数の本体を抽出中...")
             target_code = self._extract_target_function(source_code, parsed_data.function_name)
             if target_code:
+                # v5.7.0: 分岐カバレッジプローブを埋め込む
+                if self.branch_coverage:
+                    target_code = self._instrument_branch_probes(target_code, parsed_data)
+                    support_code = self._generate_branch_coverage_support()
+                    if support_code:
+                        test_code.type_definitions = (
+                            test_code.type_definitions + "\n\n" + support_code
+                            if test_code.type_definitions else support_code)
                 test_code.target_function_code = target_code
                 self.logger.info("✓ v2.2: テスト対象関数の本体を追加しました")
             else:
@@ -131,6 +188,11 @@ class UnityTestGenerator:
         target_function_code = self._extract_target_function(
             modified_source, parsed_data.function_name
         )
+
+        # v5.7.0: 分岐カバレッジプローブを埋め込む
+        if self.branch_coverage and target_function_code:
+            target_function_code = self._instrument_branch_probes(
+                target_function_code, parsed_data)
         
         # v4.8.7: main関数と対象外関数を除外
         modified_source = self._remove_non_target_functions(
@@ -152,6 +214,7 @@ class UnityTestGenerator:
         
         # Unity framework のインクルード
         parts.append('#include "unity.h"')
+        parts.append('#include <string.h>  // スナップショット復元のmemcpy用')
         
         # モック変数とモック関数
         mock_code = self.mock_gen.generate_mocks(parsed_data)
@@ -160,7 +223,21 @@ class UnityTestGenerator:
             parts.append(mock_code)
         
         # テスト関数群
+        # v5.4.0: フィクスチャサイドカーの登録はテスト関数生成中に行われる
+        if self.fixture_blob_gen:
+            self.fixture_blob_gen.reset()
         test_functions = self._generate_all_test_functions(truth_table, parsed_data)
+
+        # v5.4.0: サイドカーへ移されたフィクスチャがあればmmapサポートコードを先に配置
+        if self.fixture_blob_gen and self.fixture_blob_gen.has_fixtures():
+            parts.append("")
+            parts.append(self.fixture_blob_gen.generate_support_code(parsed_data.function_name))
+
+        # v5.7.0: 分岐カバレッジのサポートコード（カウンタ・プローブマクロ・レポート）
+        if self.branch_coverage and self._instrumented_conditions:
+            parts.append("")
+            parts.append(self._generate_branch_coverage_support())
+
         if test_functions:
             parts.append("\n// ===== テスト関数群 =====")
             parts.append(test_functions)
@@ -171,10 +248,13 @@ class UnityTestGenerator:
             parts.append("\n// ===== setUp/tearDown =====")
             parts.append(setup_teardown)
         
-        # main関数
+        # main関数（v5.6.0: スイートモードではスイートエントリ関数）
         main_function = self._generate_main_function(truth_table, parsed_data)
         if main_function:
-            parts.append("\n// ===== main関数 =====")
+            if self.suite_mode:
+                parts.append("\n// ===== スイートエントリ =====")
+            else:
+                parts.append("\n// ===== main関数 =====")
             parts.append(main_function)
         
         # v5.1.11: 対象関数の実装をファイル末尾に配置
@@ -433,8 +513,119 @@ class UnityTestGenerator:
             i += 1
         
         return '\n'.join(function_lines)
-    
-    def _remove_target_function_implementation(self, source_code: str, 
+
+    def _instrument_branch_probes(self, target_code: str, parsed_data: ParsedData) -> str:
+        """
+        対象関数のif条件に分岐カバレッジプローブを埋め込む (v5.7.0)
+
+        condition_extractorが特定した各if条件を
+        UNITY_BRANCH_PROBE(インデックス, 条件式) で包む。
+        プローブは単一の加算のみで真偽それぞれのヒット回数を記録する。
+        switch条件は真偽の区別がないため対象外。
+
+        Args:
+            target_code: 抽出済みの対象関数コード
+            parsed_data: 解析済みデータ
+
+        Returns:
+            プローブ埋め込み後のコード
+        """
+        import re
+
+        self._instrumented_conditions = []
+        if not parsed_data or not parsed_data.conditions:
+            return target_code
+
+        code = target_code
+        for condition in parsed_data.conditions:
+            if condition.type == ConditionType.SWITCH:
+                continue
+
+            idx = len(self._instrumented_conditions)
+            expr = condition.expression
+            probe = f"if (UNITY_BRANCH_PROBE({idx}, {expr}))"
+
+            # まずソースそのままの形で置換を試みる
+            plain = f"if ({expr})"
+            if plain in code:
+                code = code.replace(plain, probe, 1)
+                self._instrumented_conditions.append((idx, expr, condition.line))
+                continue
+
+            # 空白の揺れを許容して再試行
+            pattern = re.compile(r'if\s*\(\s*' + re.escape(expr) + r'\s*\)')
+            code, replaced = pattern.subn(probe, code, count=1)
+            if replaced:
+                self._instrumented_conditions.append((idx, expr, condition.line))
+            else:
+                self.logger.warning(
+                    f"v5.7.0: 分岐プローブを埋め込めませんでした: {expr} (行{condition.line})")
+
+        if self._instrumented_conditions:
+            self.logger.info(
+                f"v5.7.0: {len(self._instrumented_conditions)}個のif条件に"
+                "分岐カバレッジプローブを埋め込みました")
+
+        return code
+
+    def _generate_branch_coverage_support(self) -> str:
+        """
+        分岐カバレッジ計測のサポートコードを生成 (v5.7.0)
+
+        条件ごとのヒットカウンタ配列・プローブマクロ・レポート関数を出力する。
+        カウンタはインデックス済みの配列への単一加算で更新され、
+        gcovによる再ビルド・再実行なしに同一ランからカバレッジ根拠を得る。
+
+        Returns:
+            サポートコード（プローブがない場合は空文字列）
+        """
+        if not self._instrumented_conditions:
+            return ""
+
+        count = len(self._instrumented_conditions)
+
+        lines = []
+        lines.append("// ===== 分岐カバレッジ計測 (v5.7.0) =====")
+        lines.append("")
+        lines.append(f"#define UNITY_BRANCH_PROBE_COUNT {count}")
+        lines.append("")
+        lines.append("// 条件ごとのヒットカウンタ（[0]=偽, [1]=真）")
+        lines.append("static unsigned long unity_branch_hits[UNITY_BRANCH_PROBE_COUNT][2];")
+        lines.append("")
+        lines.append("// プローブ: 条件値を保ったまま単一の加算でヒットを記録（関数呼び出しなし）")
+        lines.append("#define UNITY_BRANCH_PROBE(idx, cond) \\")
+        lines.append("    ((cond) ? (unity_branch_hits[(idx)][1]++, 1) : (unity_branch_hits[(idx)][0]++, 0))")
+        lines.append("")
+        lines.append("// 条件式の一覧（レポート用）")
+        lines.append("static const char *const unity_branch_exprs[UNITY_BRANCH_PROBE_COUNT] = {")
+        for _, expr, line_no in self._instrumented_conditions:
+            escaped = expr.replace('\\', '\\\\').replace('"', '\\"')
+            lines.append(f"    \"{escaped} (line {line_no})\",")
+        lines.append("};")
+        lines.append("")
+        lines.append("/**")
+        lines.append(" * 分岐カバレッジをコンパクトに出力（テスト集計の直前に呼ぶ）")
+        lines.append(" */")
+        lines.append("static void unity_branch_coverage_report(void) {")
+        lines.append("    unsigned int i;")
+        lines.append("    unsigned int both_ways = 0;")
+        lines.append("    printf(\"\\n----- BRANCH COVERAGE -----\\n\");")
+        lines.append("    for (i = 0; i < UNITY_BRANCH_PROBE_COUNT; i++) {")
+        lines.append("        int covered = (unity_branch_hits[i][0] > 0 && unity_branch_hits[i][1] > 0);")
+        lines.append("        if (covered) {")
+        lines.append("            both_ways++;")
+        lines.append("        }")
+        lines.append("        printf(\"[%c] #%u T:%lu F:%lu %s\\n\", covered ? 'x' : ' ', i,")
+        lines.append("               unity_branch_hits[i][1], unity_branch_hits[i][0],")
+        lines.append("               unity_branch_exprs[i]);")
+        lines.append("    }")
+        lines.append("    printf(\"Branch coverage: %u/%u conditions hit both ways\\n\",")
+        lines.append("           both_ways, (unsigned int)UNITY_BRANCH_PROBE_COUNT);")
+        lines.append("}")
+
+        return '\n'.join(lines)
+
+    def _remove_target_function_implementation(self, source_code: str,
                                                 target_function_name: str) -> str:
         """
         対象関数の実装を除去する (v5.1.11)
@@ -611,74 +802,273 @@ class UnityTestGenerator:
         
         return '\n'.join(lines)
     
+    def generate_combined_runner(self, function_names: List[str]) -> str:
+        """
+        複数スイートを1バイナリで実行する結合ランナーを生成 (v5.6.0)
+
+        suite_mode=Trueで生成された各ハーネスのスイートエントリを順に呼び、
+        UNITY_BEGIN/UNITY_ENDによる集計を1回だけ行う。スイート間の
+        ファイル名表示はスイートエントリ内のUnitySetTestFileが切り替える。
+        プロセス起動とリンクのコストをスイート数によらず1回に抑えられる。
+
+        Args:
+            function_names: テスト対象関数名のリスト（スイートの実行順）
+
+        Returns:
+            結合ランナーのCコード
+        """
+        lines = []
+        lines.append("/*")
+        lines.append(" * 結合テストランナー")
+        lines.append(" *")
+        lines.append(" * このファイルは自動生成されました")
+        lines.append(" * suite_modeで生成された複数のハーネスを1バイナリで実行する")
+        lines.append(" */")
+        lines.append("")
+        lines.append("#include \"unity.h\"")
+        lines.append("")
+        lines.append("// 各スイートのエントリーポイント")
+        for func_name in function_names:
+            lines.append(f"extern void run_test_suite_{func_name}(void);")
+        lines.append("")
+        lines.append("// 各スイートがエントリ内で自分の実装を設定するディスパッチポインタ")
+        lines.append("void (*unity_suite_setUp)(void) = NULL;")
+        lines.append("void (*unity_suite_tearDown)(void) = NULL;")
+        lines.append("")
+        lines.append("void setUp(void) {")
+        lines.append("    if (unity_suite_setUp) {")
+        lines.append("        unity_suite_setUp();")
+        lines.append("    }")
+        lines.append("}")
+        lines.append("")
+        lines.append("void tearDown(void) {")
+        lines.append("    if (unity_suite_tearDown) {")
+        lines.append("        unity_suite_tearDown();")
+        lines.append("    }")
+        lines.append("}")
+        lines.append("")
+        lines.append("/**")
+        lines.append(" * 全スイートを1プロセスで実行し、集計を1回だけ出力する")
+        lines.append(" */")
+        lines.append("int main(void) {")
+        lines.append("    UNITY_BEGIN();")
+        lines.append("    ")
+        for func_name in function_names:
+            lines.append(f"    run_test_suite_{func_name}();")
+        lines.append("    ")
+        lines.append("    return UNITY_END();")
+        lines.append("}")
+
+        return '\n'.join(lines)
+
+    def write_fixture_blob(self, output_dir: str, parsed_data: ParsedData) -> Optional[str]:
+        """
+        フィクスチャサイドカーファイルを書き出す (v5.4.0)
+
+        generate()/generate_standalone()の後に呼び、生成コードと同じ
+        ディレクトリにバイナリサイドカーを配置する。
+
+        Args:
+            output_dir: 出力ディレクトリ（生成テストコードと同じ場所）
+            parsed_data: 解析済みデータ
+
+        Returns:
+            書き出したファイルのパス（サイドカー無効/フィクスチャなしはNone）
+        """
+        if not self.fixture_blob_gen:
+            return None
+        return self.fixture_blob_gen.write_blob(output_dir, parsed_data.function_name)
+
     def _generate_all_test_functions(self, truth_table: TruthTableData, parsed_data: ParsedData) -> str:
         """
         全てのテスト関数を生成
-        
+
+        v5.3.0: テーブル駆動モードでは、同一条件のテストケース群を
+        1つのパラメータ化テスト関数に集約する（集約できないグループは従来形式）。
+
         Args:
             truth_table: 真偽表データ
             parsed_data: 解析済みデータ
-        
+
         Returns:
             テスト関数群
         """
         lines = []
         lines.append("// ===== テスト関数 =====")
         lines.append("")
-        
+
         # テストケースサマリー
         summary = self.comment_gen.generate_test_summary(truth_table.test_cases)
         lines.append(summary)
         lines.append("")
-        
+
+        # v5.3.0: テーブル駆動モードの集約結果をリセット
+        self._table_func_names = {}
+
+        # v5.3.0: テーブル駆動モードでは条件ごとにグループ化して集約を試みる
+        if self.table_driven:
+            for _, group in self._group_test_cases_by_condition(truth_table.test_cases):
+                collapsed = self.test_func_gen.generate_table_driven_function(group, parsed_data)
+                if collapsed:
+                    func_name, test_func = collapsed
+                    for test_case in group:
+                        self._table_func_names[test_case.no] = func_name
+
+                    storage = "static " if self.suite_mode else ""
+                    lines.append(f"// プロトタイプ宣言")
+                    lines.append(f"{storage}void {func_name}(void);")
+                    lines.append("")
+                    lines.append(test_func)
+                    lines.append("")
+                    self.logger.info(
+                        f"v5.3.0: {len(group)}個のテストケースをテーブル駆動形式で集約: {func_name}")
+                    continue
+
+                # 集約できないグループは従来の行ごとの関数生成
+                for test_case in group:
+                    self._append_single_test_function(test_case, parsed_data, lines)
+
+            return '\n'.join(lines)
+
         # 各テスト関数を生成（プロトタイプ宣言 + 本体）
         for test_case in truth_table.test_cases:
-            # テスト関数名を生成
-            func_name = self.test_func_gen._generate_test_name(test_case, parsed_data)
-            
-            # プロトタイプ宣言を追加
-            lines.append(f"// プロトタイプ宣言")
-            lines.append(f"void {func_name}(void);")
-            lines.append("")
-            
-            # テスト関数本体を生成
-            test_func = self.test_func_gen.generate_test_function(test_case, parsed_data)
-            lines.append(test_func)
-            lines.append("")
-        
+            self._append_single_test_function(test_case, parsed_data, lines)
+
         return '\n'.join(lines)
+
+    def _append_single_test_function(self, test_case: TestCase, parsed_data: ParsedData,
+                                     lines: list) -> None:
+        """
+        1テストケース分のプロトタイプ宣言と関数本体を追加 (v5.3.0: 共通化)
+
+        Args:
+            test_case: テストケース
+            parsed_data: 解析済みデータ
+            lines: 出力先の行リスト
+        """
+        # テスト関数名を生成
+        func_name = self.test_func_gen._generate_test_name(test_case, parsed_data)
+
+        # プロトタイプ宣言を追加（v5.6.1: スイートモードでは定義と同じくstatic）
+        storage = "static " if self.suite_mode else ""
+        lines.append(f"// プロトタイプ宣言")
+        lines.append(f"{storage}void {func_name}(void);")
+        lines.append("")
+
+        # テスト関数本体を生成
+        test_func = self.test_func_gen.generate_test_function(test_case, parsed_data)
+        lines.append(test_func)
+        lines.append("")
     
     def _generate_setup_teardown(self, parsed_data: ParsedData = None) -> str:
         """
-        setUp/tearDown関数を生成 (v5.0.0: static/global変数初期化追加, v5.0.2: 関数分離)
-        
+        setUp/tearDown関数を生成 (v5.0.0: static/global変数初期化追加, v5.0.2: 関数分離,
+        v5.1.0: スナップショット/一括復元方式)
+
         Args:
             parsed_data: 解析済みデータ（v5.0.0で追加）
-        
+
         Returns:
             setUp/tearDown関数
         """
         lines = []
-        
-        # v5.0.2: reset_all_global_values関数を生成
-        init_code = []
+
+        # v5.1.0: スナップショット対象の変数を収集
+        snapshot_vars = []
         if parsed_data:
-            init_code = self._generate_variable_init_code(parsed_data)
-        
-        lines.append("// ===== グローバル変数リセット関数 =====")
+            snapshot_vars = self._collect_snapshot_variables(parsed_data)
+
+        lines.append("// ===== グローバル変数スナップショット =====")
         lines.append("")
+        if snapshot_vars:
+            # 記述子テーブル: 変数のアドレスとサイズを列挙
+            lines.append("/**")
+            lines.append(" * スナップショット記述子（変数のアドレスとサイズ）")
+            lines.append(" */")
+            lines.append("typedef struct {")
+            lines.append("    void *address;")
+            lines.append("    size_t size;")
+            lines.append("} global_snapshot_entry_t;")
+            lines.append("")
+            lines.append("static const global_snapshot_entry_t global_snapshot_entries[] = {")
+            for var_name in snapshot_vars:
+                lines.append(f"    {{ (void *)&{var_name}, sizeof({var_name}) }},")
+            lines.append("};")
+            lines.append("")
+            lines.append("#define GLOBAL_SNAPSHOT_ENTRY_COUNT (sizeof(global_snapshot_entries) / sizeof(global_snapshot_entries[0]))")
+            lines.append("")
+            # 全変数を連結して保持する1枚のイメージ
+            sizeof_sum = " + ".join(f"sizeof({name})" for name in snapshot_vars)
+            lines.append(f"static unsigned char global_snapshot_image[{sizeof_sum}];")
+            lines.append("static int global_snapshot_captured = 0;")
+            lines.append("")
+            lines.append("/**")
+            lines.append(" * 初期化直後のグローバル変数を1枚のイメージとして退避")
+            lines.append(" */")
+            lines.append("static void capture_global_snapshot(void) {")
+            lines.append("    size_t offset = 0;")
+            lines.append("    size_t i;")
+            lines.append("    for (i = 0; i < GLOBAL_SNAPSHOT_ENTRY_COUNT; i++) {")
+            lines.append("        memcpy(&global_snapshot_image[offset], global_snapshot_entries[i].address, global_snapshot_entries[i].size);")
+            lines.append("        offset += global_snapshot_entries[i].size;")
+            lines.append("    }")
+            lines.append("    global_snapshot_captured = 1;")
+            lines.append("}")
+            lines.append("")
+            lines.append("/**")
+            lines.append(" * 退避イメージからグローバル変数を一括復元")
+            lines.append(" */")
+            lines.append("static void restore_global_snapshot(void) {")
+            lines.append("    size_t offset = 0;")
+            lines.append("    size_t i;")
+            lines.append("    for (i = 0; i < GLOBAL_SNAPSHOT_ENTRY_COUNT; i++) {")
+            lines.append("        memcpy(global_snapshot_entries[i].address, &global_snapshot_image[offset], global_snapshot_entries[i].size);")
+            lines.append("        offset += global_snapshot_entries[i].size;")
+            lines.append("    }")
+            lines.append("}")
+            lines.append("")
         lines.append("/**")
         lines.append(" * 全てのstatic変数・グローバル変数をリセット")
+        lines.append(" * v5.1.0: 初回は初期値イメージを退避し、2回目以降は一括復元する")
         lines.append(" */")
         lines.append("static void reset_all_global_values(void) {")
-        if init_code:
-            for line in init_code:
-                lines.append(f"    {line}")
+        if snapshot_vars:
+            lines.append("    if (!global_snapshot_captured) {")
+            lines.append("        capture_global_snapshot();")
+            lines.append("        return;  // 初回は初期値のまま実行")
+            lines.append("    }")
+            lines.append("    restore_global_snapshot();")
         else:
             lines.append("    // 初期化対象の変数なし")
         lines.append("}")
         lines.append("")
-        
+
+        # v5.6.0: スイートモードではグローバルなsetUp/tearDownは結合ランナー側で
+        # 1つだけ定義し、各スイートはstaticな実装を関数ポインタ経由で提供する
+        if self.suite_mode:
+            func_name = parsed_data.function_name if parsed_data else "suite"
+            lines.append("// ===== setUp/tearDown（スイート実装） =====")
+            lines.append("")
+            lines.append("/**")
+            lines.append(" * 各テストの前に実行（結合ランナーのsetUp()から呼ばれる）")
+            lines.append(" */")
+            lines.append(f"static void {func_name}_suite_setUp(void) {{")
+            lines.append("    // モックをリセット")
+            lines.append("    reset_all_mocks();")
+            lines.append("")
+            lines.append("    // グローバル変数をリセット")
+            lines.append("    reset_all_global_values();")
+            lines.append("}")
+            lines.append("")
+            lines.append("/**")
+            lines.append(" * 各テストの後に実行（結合ランナーのtearDown()から呼ばれる）")
+            lines.append(" */")
+            lines.append(f"static void {func_name}_suite_tearDown(void) {{")
+            lines.append("    // クリーンアップ処理")
+            lines.append("}")
+
+            return '\n'.join(lines)
+
         lines.append("// ===== setUp/tearDown =====")
         lines.append("")
         lines.append("/**")
@@ -698,23 +1088,23 @@ class UnityTestGenerator:
         lines.append("void tearDown(void) {")
         lines.append("    // クリーンアップ処理")
         lines.append("}")
-        
-        return '\n'.join(lines)
-        
+
         return '\n'.join(lines)
     
-    def _generate_variable_init_code(self, parsed_data: ParsedData) -> list:
+    def _collect_snapshot_variables(self, parsed_data: ParsedData) -> list:
         """
-        static変数とグローバル変数の初期化コードを生成 (v5.0.4: 全関数パラメータ除外)
-        
+        スナップショット対象の変数名を収集 (v5.1.0)
+
+        従来の変数別初期化 (v5.0.0〜v5.0.4) と同じ除外規則を適用する:
+        関数パラメータ・ローカル変数・構造体メンバーは対象外。
+        アドレスとsizeofで一括退避するため、型ごとの初期化コードは不要。
+
         Args:
             parsed_data: 解析済みデータ
-        
+
         Returns:
-            初期化コード行のリスト
+            変数名のリスト（宣言順）
         """
-        init_lines = []
-        
         # v5.0.4: 全関数のパラメータ名を収集（これらは除外対象）
         param_names = set()
         if hasattr(parsed_data, 'function_signatures') and parsed_data.function_signatures:
@@ -733,7 +1123,7 @@ class UnityTestGenerator:
                             parts = param.split()
                             if parts:
                                 param_names.add(parts[-1].replace('*', ''))
-        
+
         # function_infoからもパラメータ名を収集（テスト対象関数）
         if hasattr(parsed_data, 'function_info') and parsed_data.function_info:
             if hasattr(parsed_data.function_info, 'parameters'):
@@ -746,42 +1136,36 @@ class UnityTestGenerator:
                         parts = param.split()
                         if parts:
                             param_names.add(parts[-1].replace('*', ''))
-        
+
         # v5.0.3: ローカル変数名を収集（これらも除外対象）
         local_var_names = set()
         if hasattr(parsed_data, 'local_variables') and parsed_data.local_variables:
             local_var_names = set(parsed_data.local_variables.keys())
-        
-        # static変数の初期化
+
+        snapshot_names = []
+
+        # static変数
         if hasattr(parsed_data, 'static_variables') and parsed_data.static_variables:
             for var in parsed_data.static_variables:
                 # パラメータやローカル変数は除外
                 if var.name in param_names or var.name in local_var_names:
                     continue
-                init_line = self._generate_single_var_init(var, parsed_data)
-                if init_line:
-                    init_lines.append(init_line)
-        
-        # グローバル変数の初期化
+                snapshot_names.append(var.name)
+
+        # グローバル変数
         if hasattr(parsed_data, 'global_variable_infos') and parsed_data.global_variable_infos:
             for var in parsed_data.global_variable_infos:
                 # パラメータやローカル変数は除外
                 if var.name in param_names or var.name in local_var_names:
                     continue
-                init_line = self._generate_single_var_init(var, parsed_data)
-                if init_line:
-                    init_lines.append(init_line)
-        
+                snapshot_names.append(var.name)
+
         # 従来のglobal_variables（名前のみ）も処理
         # ただし、static_variablesとglobal_variable_infosで処理済みの場合は除外
         if hasattr(parsed_data, 'global_variables') and parsed_data.global_variables:
             # 既に処理済みの変数名を収集
-            processed_names = set()
-            if hasattr(parsed_data, 'global_variable_infos'):
-                processed_names = {v.name for v in parsed_data.global_variable_infos}
-            if hasattr(parsed_data, 'static_variables'):
-                processed_names |= {v.name for v in parsed_data.static_variables}
-            
+            processed_names = set(snapshot_names)
+
             # 構造体のメンバー名を収集（これらは除外）
             struct_member_names = set()
             if hasattr(parsed_data, 'struct_definitions'):
@@ -790,7 +1174,7 @@ class UnityTestGenerator:
                         for member in struct_def.members:
                             if hasattr(member, 'name'):
                                 struct_member_names.add(member.name)
-            
+
             for var_name in parsed_data.global_variables:
                 # 既に処理済み、構造体メンバー、パラメータ、ローカル変数の場合は除外
                 if var_name in processed_names:
@@ -801,115 +1185,11 @@ class UnityTestGenerator:
                     continue
                 if var_name in local_var_names:
                     continue
-                # 型情報がない場合は0で初期化
-                init_lines.append(f"{var_name} = 0;")
-        
-        return init_lines
-    
-    def _generate_single_var_init(self, var, parsed_data: ParsedData) -> str:
-        """
-        単一変数の初期化コードを生成 (v5.0.0, v5.0.2: extern変数も初期化)
-        
-        Args:
-            var: VariableDeclInfo
-            parsed_data: 解析済みデータ
-        
-        Returns:
-            初期化コード行
-        """
-        var_name = var.name
-        var_type = var.var_type
-        
-        # v5.0.2: extern変数も初期化対象に含める（コメントで明示）
-        # extern変数は他のモジュールで定義されているが、テスト時はリセットする
-        
-        # 配列の場合
-        if var.is_array:
-            if var.array_size and var.array_size > 0:
-                return f"memset({var_name}, 0, sizeof({var_name}));"
-            else:
-                return f"memset({var_name}, 0, sizeof({var_name}));"
-        
-        # 構造体の場合
-        if var.is_struct or self._is_struct_type(var_type, parsed_data):
-            return f"memset(&{var_name}, 0, sizeof({var_name}));"
-        
-        # ポインタの場合
-        if '*' in var_type:
-            return f"{var_name} = NULL;"
-        
-        # 基本型の場合
-        if self._is_integer_type(var_type):
-            return f"{var_name} = 0;"
-        elif self._is_float_type(var_type):
-            return f"{var_name} = 0.0;"
-        elif 'char' in var_type.lower():
-            return f"{var_name} = '\\0';"
-        else:
-            # 不明な型は0で初期化
-            return f"{var_name} = 0;"
-    
-    def _is_struct_type(self, var_type: str, parsed_data: ParsedData) -> bool:
-        """
-        型名が構造体かどうか判定 (v5.0.0)
-        
-        Args:
-            var_type: 型名
-            parsed_data: 解析済みデータ
-        
-        Returns:
-            構造体ならTrue
-        """
-        if 'struct' in var_type:
-            return True
-        
-        # typedef された構造体名をチェック
-        clean_type = var_type.replace('*', '').replace('const', '').strip()
-        
-        # struct_definitionsからチェック
-        if hasattr(parsed_data, 'struct_definitions'):
-            for struct_def in parsed_data.struct_definitions:
-                if struct_def.name == clean_type or struct_def.original_name == clean_type:
-                    return True
-        
-        # typedefsからチェック
-        if hasattr(parsed_data, 'typedefs'):
-            for typedef in parsed_data.typedefs:
-                if hasattr(typedef, 'name') and typedef.name == clean_type:
-                    if hasattr(typedef, 'original_type') and 'struct' in str(typedef.original_type):
-                        return True
-        
-        return False
-    
-    def _is_integer_type(self, var_type: str) -> bool:
-        """整数型かどうか判定"""
-        int_types = [
-            'int', 'short', 'long', 'char',
-            'uint8_t', 'uint16_t', 'uint32_t', 'uint64_t',
-            'int8_t', 'int16_t', 'int32_t', 'int64_t',
-            'size_t', 'ssize_t', 'ptrdiff_t',
-            'unsigned', 'signed',
-            'BYTE', 'WORD', 'DWORD', 'BOOL',
-            # 組込み系でよく使われる型
-            'U8', 'U16', 'U32', 'U64',
-            'S8', 'S16', 'S32', 'S64',
-        ]
-        clean_type = var_type.replace('unsigned', '').replace('signed', '').strip()
-        for itype in int_types:
-            if itype in clean_type:
-                return True
-        return False
-    
-    def _is_float_type(self, var_type: str) -> bool:
-        """浮動小数点型かどうか判定"""
-        float_types = ['float', 'double', 'long double']
-        for ftype in float_types:
-            if ftype in var_type:
-                return True
-        return False
-        
-        return '\n'.join(lines)
-    
+                snapshot_names.append(var_name)
+
+        return snapshot_names
+
+
     def _generate_main_function(self, truth_table: TruthTableData, parsed_data: ParsedData) -> str:
         """
         main関数を生成（v2.3の新機能）
@@ -922,14 +1202,45 @@ class UnityTestGenerator:
             main関数のコード
         """
         lines = []
-        lines.append("// ===== main関数 =====")
-        lines.append("")
-        lines.append("/**")
-        lines.append(" * テストスイートのエントリーポイント")
-        lines.append(" */")
-        lines.append("int main(void) {")
-        lines.append("    UNITY_BEGIN();")
-        lines.append("    ")
+
+        # v5.6.0: スイートモードではmain()の代わりにスイートエントリ関数を生成
+        if self.suite_mode:
+            func_name = parsed_data.function_name
+            lines.append("// ===== スイートエントリ =====")
+            lines.append("")
+            lines.append("// 結合ランナーが定義するsetUp/tearDownディスパッチポインタ")
+            lines.append("extern void (*unity_suite_setUp)(void);")
+            lines.append("extern void (*unity_suite_tearDown)(void);")
+            lines.append("")
+            lines.append("/**")
+            lines.append(" * スイートエントリーポイント (v5.6.0)")
+            lines.append(" * main()とUNITY_BEGIN/UNITY_ENDは結合ランナー側で1回だけ実行される")
+            lines.append(" */")
+            lines.append(f"void run_test_suite_{func_name}(void) {{")
+            lines.append(f"    UnitySetTestFile(\"test_{func_name}_mcdc.c\");")
+            lines.append(f"    unity_suite_setUp = {func_name}_suite_setUp;")
+            lines.append(f"    unity_suite_tearDown = {func_name}_suite_tearDown;")
+
+            # v5.4.0: フィクスチャサイドカーはスイート先頭でmmapする
+            if self.fixture_blob_gen and self.fixture_blob_gen.has_fixtures():
+                lines.append("")
+                lines.append(self.fixture_blob_gen.generate_map_call(func_name))
+            lines.append("    ")
+        else:
+            lines.append("// ===== main関数 =====")
+            lines.append("")
+            lines.append("/**")
+            lines.append(" * テストスイートのエントリーポイント")
+            lines.append(" */")
+            lines.append("int main(void) {")
+
+            # v5.4.0: フィクスチャサイドカーをUNITY_BEGIN前にmmapする
+            if self.fixture_blob_gen and self.fixture_blob_gen.has_fixtures():
+                lines.append(self.fixture_blob_gen.generate_map_call(parsed_data.function_name))
+                lines.append("")
+
+            lines.append("    UNITY_BEGIN();")
+            lines.append("    ")
         
         # ヘッダー情報
         lines.append("    printf(\"==============================================\\n\");")
@@ -954,14 +1265,32 @@ class UnityTestGenerator:
             lines.append(f"    printf(\"--- {condition_desc} (No.{start_no}-{end_no}) ---\\n\");")
             
             # 各テストケースのRUN_TEST
+            # v5.3.0: テーブル駆動関数に集約されたケースは関数単位で1回だけ実行
+            emitted_table_funcs = set()
             for test_case in test_cases:
+                table_func = self._table_func_names.get(test_case.no)
+                if table_func:
+                    if table_func not in emitted_table_funcs:
+                        emitted_table_funcs.add(table_func)
+                        lines.append(f"    RUN_TEST({table_func});")
+                    continue
                 func_name = self.test_func_gen._generate_test_name(test_case, parsed_data)
                 lines.append(f"    RUN_TEST({func_name});")
         
         lines.append("    ")
-        lines.append("    return UNITY_END();")
-        lines.append("}")
-        
+
+        # v5.7.0: 集計の直前に分岐カバレッジを出力
+        if self.branch_coverage and self._instrumented_conditions:
+            lines.append("    unity_branch_coverage_report();")
+            lines.append("    ")
+
+        if self.suite_mode:
+            # v5.6.0: 集計は結合ランナーのUNITY_ENDが行う
+            lines.append("}")
+        else:
+            lines.append("    return UNITY_END();")
+            lines.append("}")
+
         return '\n'.join(lines)
     
     def _group_test_cases_by_condition(self, test_cases: List[TestCase]) -> List[tuple]:
@@ -1,7 +1,12 @@
 """
-MCDCPatternGenerator v4.7.3 - 階層分解アルゴリズム (シンプル版)
+MCDCPatternGenerator v4.8.0 - 階層分解アルゴリズム (遅延ビットセット版)
 
 複合条件を解析し、構造情報を活用して最小MC/DCパターンを生成する。
+
+v4.8.0: 独立性ペアの探索を遅延評価に変更。行をビットセット
+（パックした整数）で表現し、条件ごとにペアが見つかった時点で
+打ち切るため、メモリは条件数に比例し、14個程度の条件でも
+2^14行の真理値表を構築しない。
 """
 
 import sys
@@ -61,6 +66,24 @@ class ConditionNode:
     
     def evaluate_with_list(self, values: List[bool]) -> bool:
         return self.evaluate({i: v for i, v in enumerate(values)})
+
+    def evaluate_mask(self, mask: int, leaf_index: List[int] = None) -> bool:
+        """ビットセット表現の行を評価（葉iの真偽値 = maskのビットi）"""
+        if leaf_index is None:
+            leaf_index = [0]
+
+        if self.is_leaf():
+            idx = leaf_index[0]
+            leaf_index[0] += 1
+            return (mask >> idx) & 1 == 1
+
+        if self.operator == OperatorType.OR:
+            results = [child.evaluate_mask(mask, leaf_index) for child in self.children]
+            return any(results)
+        elif self.operator == OperatorType.AND:
+            results = [child.evaluate_mask(mask, leaf_index) for child in self.children]
+            return all(results)
+        return False
     
     def __repr__(self):
         if self.is_leaf():
@@ -69,7 +92,7 @@ class ConditionNode:
 
 
 class MCDCPatternGeneratorV4:
-    """MC/DCパターンジェネレータ v4.7.3"""
+    """MC/DCパターンジェネレータ v4.8.0"""
     
     def __init__(self):
         self.logger = setup_logger(__name__)
@@ -142,88 +165,147 @@ class MCDCPatternGeneratorV4:
         n = len(leaves)
         
         self.logger.info(f"条件式をパース: {n}個の葉条件を検出")
-        
-        # 各条件の独立性ペア候補を全探索で生成
-        all_pairs = []
+
+        # 条件ごとに独立性ペアを1組ずつ遅延探索し、見つかり次第打ち切る。
+        # 行はビットセット（葉iの真偽値 = ビットi）で保持するため、
+        # メモリは選択済みパターン数（条件数に比例）に収まる。
+        selected: Set[int] = set()
+
         for target_idx in range(n):
-            pairs = self._find_independence_pairs(root, target_idx, n)
-            all_pairs.append(pairs)
-        
-        # 貪欲法で最小パターンセットを選択
-        selected = self._select_minimal_patterns(all_pairs, n)
-        
-        pattern_strings = [''.join('T' if v else 'F' for v in p) 
-                          for p in sorted(selected)]
+            pair = self._find_independence_pair(root, target_idx, n, selected)
+
+            if pair is None:
+                self.logger.warning(f"条件{target_idx}に有効な独立性ペアがありません")
+                continue
+
+            selected.add(pair[0])
+            selected.add(pair[1])
+
+        pattern_strings = sorted(
+            ''.join('T' if (row >> i) & 1 else 'F' for i in range(n))
+            for row in selected
+        )
         leaf_texts = [leaf.text for leaf in leaves]
-        
+
         self.logger.info(f"生成されたパターン数: {len(pattern_strings)}個 (最小化済み)")
-        
+
         return pattern_strings, leaf_texts
-    
-    def _find_independence_pairs(self, root: ConditionNode, target_idx: int, n: int) -> List[Tuple[Tuple[bool, ...], Tuple[bool, ...]]]:
-        """対象条件の全ての有効な独立性ペアを探索"""
-        valid_pairs = []
-        
-        for i in range(2 ** n):
-            pattern = [(i >> j) & 1 == 1 for j in range(n)]
-            
-            if not pattern[target_idx]:
-                continue
-            
-            result_true = root.evaluate_with_list(pattern)
-            
-            pattern_false = pattern.copy()
-            pattern_false[target_idx] = False
-            result_false = root.evaluate_with_list(pattern_false)
-            
-            if result_true != result_false:
-                valid_pairs.append((tuple(pattern), tuple(pattern_false)))
-        
-        return valid_pairs
-    
-    def _select_minimal_patterns(self, all_pairs: List[List[Tuple]], n: int) -> Set[Tuple[bool, ...]]:
-        """貪欲法で最小パターンセットを選択"""
-        selected: Set[Tuple[bool, ...]] = set()
-        
-        # ペア候補が少ない条件から処理
-        order = sorted(range(n), key=lambda i: len(all_pairs[i]))
-        
-        for cond_idx in order:
-            pairs = all_pairs[cond_idx]
-            
-            if not pairs:
-                self.logger.warning(f"条件{cond_idx}に有効な独立性ペアがありません")
+
+    def _find_independence_pair(self, root: ConditionNode, target_idx: int,
+                                n: int, selected: Set[int]) -> Optional[Tuple[int, int]]:
+        """
+        対象条件の独立性ペアを1組探索する（遅延評価）
+
+        候補は次の順で試し、見つかった時点で打ち切る:
+        1. 選択済みパターンの対象ビットを反転（新規パターン最少を優先）
+        2. 条件構造から直接構成したシード行（AND/OR木ならO(n)で必ず有効）
+        3. 全行の遅延列挙（フォールバック。全探索しても格納はしない）
+
+        Returns:
+            (行, 対象ビットを反転した行) のペア、見つからない場合はNone
+        """
+        bit = 1 << target_idx
+
+        # 1. 選択済みパターンの再利用（新規0個 > 新規1個の順で優先）
+        best_pair = None
+        for row in sorted(selected):
+            partner = row ^ bit
+            if root.evaluate_mask(row) != root.evaluate_mask(partner):
+                if partner in selected:
+                    return (row, partner)  # 新規パターンなし
+                best_pair = (row, partner)
+        if best_pair is not None:
+            return best_pair
+
+        # 2. 構造から構成したシード行
+        seed = self._seed_row(root, target_idx)
+        if seed is not None:
+            if root.evaluate_mask(seed | bit) != root.evaluate_mask(seed & ~bit):
+                return (seed | bit, seed & ~bit)
+
+        # 3. 遅延全列挙（対象ビットが立っている行のみ評価）
+        for row in range(1 << n):
+            if not row & bit:
                 continue
-            
-            best_pair = None
-            best_new_count = float('inf')
-            best_reuse_count = -1
-            
-            for pat_true, pat_false in pairs:
-                new_count = 0
-                reuse_count = 0
-                
-                if pat_true not in selected:
-                    new_count += 1
-                else:
-                    reuse_count += 1
-                
-                if pat_false not in selected:
-                    new_count += 1
-                else:
-                    reuse_count += 1
-                
-                if (new_count < best_new_count or 
-                    (new_count == best_new_count and reuse_count > best_reuse_count)):
-                    best_new_count = new_count
-                    best_reuse_count = reuse_count
-                    best_pair = (pat_true, pat_false)
-            
-            if best_pair:
-                selected.add(best_pair[0])
-                selected.add(best_pair[1])
-        
-        return selected
+            partner = row ^ bit
+            if root.evaluate_mask(row) != root.evaluate_mask(partner):
+                return (row, partner)
+
+        return None
+
+    def _seed_row(self, root: ConditionNode, target_idx: int) -> Optional[int]:
+        """
+        対象条件が判定結果を左右する行をO(n)で直接構成する
+
+        対象の葉から根までの経路上で、ANDの兄弟部分木をTrue、
+        ORの兄弟部分木をFalseに固定すれば、対象条件の値が
+        そのまま判定結果に伝播する。
+        """
+        if root.is_leaf():
+            return 0 if target_idx == 0 else None
+
+        base = 0
+        for child in root.children:
+            count = child.count_leaves()
+            if base <= target_idx < base + count:
+                inner = self._seed_row(child, target_idx - base)
+                if inner is None:
+                    return None
+                mask = inner << base
+                # 兄弟部分木を固定
+                sibling_base = 0
+                for sibling in root.children:
+                    sibling_count = sibling.count_leaves()
+                    if sibling is not child:
+                        forced = self._force_subtree(
+                            sibling, root.operator == OperatorType.AND)
+                        mask |= forced << sibling_base
+                    sibling_base += sibling_count
+                return mask
+            base += count
+
+        return None
+
+    def _force_subtree(self, node: ConditionNode, value: bool) -> int:
+        """部分木の評価結果をvalueに固定する葉の割り当てを構成する"""
+        if node.is_leaf():
+            return 1 if value else 0
+
+        if node.operator == OperatorType.AND:
+            if value:
+                # 全ての子をTrue
+                mask = 0
+                base = 0
+                for child in node.children:
+                    mask |= self._force_subtree(child, True) << base
+                    base += child.count_leaves()
+                return mask
+            # 先頭の子だけFalse、残りはTrue
+            mask = self._force_subtree(node.children[0], False)
+            base = node.children[0].count_leaves()
+            for child in node.children[1:]:
+                mask |= self._force_subtree(child, True) << base
+                base += child.count_leaves()
+            return mask
+
+        if node.operator == OperatorType.OR:
+            if not value:
+                # 全ての子をFalse
+                mask = 0
+                base = 0
+                for child in node.children:
+                    mask |= self._force_subtree(child, False) << base
+                    base += child.count_leaves()
+                return mask
+            # 先頭の子だけTrue、残りはFalse
+            mask = self._force_subtree(node.children[0], True)
+            base = node.children[0].count_leaves()
+            for child in node.children[1:]:
+                mask |= self._force_subtree(child, False) << base
+                base += child.count_leaves()
+            return mask
+
+        return 0
     
     # 後方互換メソッド
     def generate_mcdc_patterns_for_complex(self, top_operator: str, conditions: List[str]) -> List[str]:
@@ -284,7 +366,7 @@ MCDCPatternGenerator = MCDCPatternGeneratorV4
 
 
 if __name__ == "__main__":
-    print("=== MCDCPatternGenerator v4.7.3 テスト ===\n")
+    print("=== MCDCPatternGenerator v4.8.0 テスト ===\n")
     
     gen = MCDCPatternGeneratorV4()
     